@@ -0,0 +1,211 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @file benchmark.hpp
+ * @brief Minimal, dependency-free timing harness shared by the benchmark programs.
+ *
+ * Every measurement repeats a timed body on freshly prepared state until a
+ * minimum amount of time has elapsed. Setup and teardown are never timed.
+ * Results are collected and written out as a single JSON document so that
+ * runs can be diffed and tracked for regressions.
+ */
+
+namespace benchmark
+{
+    typedef std::chrono::steady_clock clock;
+
+    /**
+     * @brief A single timed measurement.
+     */
+    struct result
+    {
+        std::string name;      ///< Operation being measured, e.g. `append`
+        std::string container; ///< Container under test, e.g. `singly_linked_list`
+        size_t size;           ///< Number of elements in the container
+        size_t ops;            ///< Operations performed per timed run
+        size_t runs;           ///< Number of timed runs
+        double total_ns;       ///< Time spent in all timed runs
+    };
+
+    /**
+     * @brief Command line options common to every benchmark program.
+     */
+    struct options
+    {
+        size_t min_size = 10;
+        size_t max_size = 1000000;
+        double min_time_ms = 50.0;
+        size_t max_runs = 1000;
+        std::string filter;
+    };
+
+    /**
+     * @brief Prevents the compiler from optimising away a computed value.
+     *
+     * @param value The value whose computation must be kept.
+     */
+    template <typename T>
+    inline void keep(const T &value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void *sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Parses the common command line options.
+     *
+     * Recognised flags are `--min-size N`, `--max-size N`, `--min-time-ms T`,
+     * `--max-runs N` and `--filter NAME`.
+     *
+     * @param argc Argument count as passed to main.
+     * @param argv Argument vector as passed to main.
+     * @return The parsed options.
+     */
+    inline options parse(int argc, char **argv)
+    {
+        options opts;
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            if (std::strcmp(argv[i], "--min-size") == 0)
+                opts.min_size = std::strtoull(argv[i + 1], nullptr, 10);
+            else if (std::strcmp(argv[i], "--max-size") == 0)
+                opts.max_size = std::strtoull(argv[i + 1], nullptr, 10);
+            else if (std::strcmp(argv[i], "--min-time-ms") == 0)
+                opts.min_time_ms = std::strtod(argv[i + 1], nullptr);
+            else if (std::strcmp(argv[i], "--max-runs") == 0)
+                opts.max_runs = std::strtoull(argv[i + 1], nullptr, 10);
+            else if (std::strcmp(argv[i], "--filter") == 0)
+                opts.filter = argv[i + 1];
+            else
+                std::cerr << "Ignoring unknown option " << argv[i] << std::endl;
+        }
+
+        return opts;
+    }
+
+    /**
+     * @brief Decade sizes from `opts.min_size` up to `opts.max_size`.
+     *
+     * @param opts The benchmark options.
+     * @return The sizes 10, 100, ... that fall inside the requested range.
+     */
+    inline std::vector<size_t> sizes(const options &opts)
+    {
+        std::vector<size_t> result;
+        for (size_t size = 10; size <= opts.max_size; size *= 10)
+        {
+            if (size >= opts.min_size)
+                result.push_back(size);
+            if (size > opts.max_size / 10)
+                break;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Times `body` on state prepared by `setup`.
+     *
+     * A fresh `State` is default constructed and passed to `setup` before each
+     * timed run, so mutating bodies always see the same input. Runs repeat until
+     * `opts.min_time_ms` has been spent in `body` or `opts.max_runs` is reached.
+     *
+     * @param opts The benchmark options.
+     * @param ops Number of operations `body` performs per run.
+     * @param setup Untimed callable preparing the state, `void(State &)`.
+     * @param body Timed callable performing the operations, `void(State &)`.
+     * @return The measured runs and elapsed time; name, container and size are left empty.
+     */
+    template <typename State, typename Setup, typename Body>
+    result measure(const options &opts, size_t ops, Setup setup, Body body)
+    {
+        result res = result();
+        res.ops = ops;
+
+        const double budget_ns = opts.min_time_ms * 1e6;
+        while (res.runs < opts.max_runs && (res.runs == 0 || res.total_ns < budget_ns))
+        {
+            State state;
+            setup(state);
+
+            clock::time_point start = clock::now();
+            body(state);
+            clock::time_point stop = clock::now();
+
+            res.total_ns += std::chrono::duration<double, std::nano>(stop - start).count();
+            res.runs++;
+            keep(state);
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief Collects results and writes them as JSON.
+     */
+    class report
+    {
+        private:
+            std::string suite;
+            std::vector<result> results;
+
+            static std::string escape(const std::string &text)
+            {
+                std::string escaped;
+                for (char c: text)
+                {
+                    if (c == '"' || c == '\\')
+                        escaped += '\\';
+                    escaped += c;
+                }
+
+                return escaped;
+            }
+        public:
+            report(const std::string &suite): suite(suite) {}
+
+            void add(const result &res)
+            {
+                this->results.push_back(res);
+                std::cerr << res.container << "/" << res.name << "/" << res.size << ": "
+                          << res.total_ns / (double)(res.runs * (res.ops ? res.ops : 1)) << " ns/op" << std::endl;
+            }
+
+            void write(std::ostream &out) const
+            {
+                out << "{\n  \"suite\": \"" << escape(this->suite) << "\",\n";
+#if defined(__VERSION__)
+                out << "  \"compiler\": \"" << escape(__VERSION__) << "\",\n";
+#endif
+                out << "  \"results\": [";
+                for (size_t i = 0; i < this->results.size(); i++)
+                {
+                    const result &res = this->results[i];
+                    double per_op = res.total_ns / (double)(res.runs * (res.ops ? res.ops : 1));
+
+                    out << (i ? "," : "") << "\n    {\"name\": \"" << escape(res.name)
+                        << "\", \"container\": \"" << escape(res.container)
+                        << "\", \"size\": " << res.size
+                        << ", \"ops\": " << res.ops
+                        << ", \"runs\": " << res.runs
+                        << ", \"total_ns\": " << (unsigned long long)res.total_ns
+                        << ", \"ns_per_op\": " << per_op << "}";
+                }
+                out << "\n  ]\n}\n";
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <random>
+
+#include "../singly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file compaction_benchmark.cpp
+ * @brief Measures traversal throughput of a singly_linked_list before and after compact().
+ *
+ * Each list is built by appending the values 0 .. size-1 in shuffled order, so
+ * the nodes are allocated in shuffled order, and then sorted, which relinks the
+ * nodes without moving them. Every hop of a traversal of the sorted list then
+ * jumps to an unrelated heap address. The `compacted` cases call compact() on
+ * the same list first; `compact` times compact() itself.
+ *
+ * Usage: `compaction_benchmark [--max-size N] [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+// Traversals per timed run, so that the untimed build dominates less
+static const size_t passes = 10;
+
+typedef singly_linked_list<int> list;
+
+/**
+ * @brief Sums the list with its iterators.
+ */
+long traverse(const list &values)
+{
+    long sum = 0;
+    for (list::const_iterator it = values.cbegin(); it != values.cend(); ++it)
+        sum += *it;
+
+    return sum;
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("compaction");
+
+    std::mt19937 rng(42);
+    std::vector<size_t> sizes = benchmark::sizes(opts);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        const size_t size = sizes[i];
+        std::vector<int> values(size);
+        for (size_t j = 0; j < size; j++)
+            values[j] = (int)j;
+        std::shuffle(values.begin(), values.end(), rng);
+
+        auto enabled = [&](const std::string &name)
+        {
+            return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+        };
+        auto add = [&](const char *name, benchmark::result res)
+        {
+            res.name = name;
+            res.container = "singly_linked_list";
+            res.size = size;
+            report.add(res);
+        };
+        auto fragmented = [&](list &l)
+        {
+            l.extend(values);
+            l.sort();
+        };
+        auto compacted = [&](list &l)
+        {
+            fragmented(l);
+            l.compact();
+        };
+        auto walk = [&](list &l)
+        {
+            for (size_t pass = 0; pass < passes; pass++)
+                benchmark::keep(traverse(l));
+        };
+
+        if (enabled("iterate/fragmented"))
+            add("iterate/fragmented", benchmark::measure<list>(opts, size * passes, fragmented, walk));
+        if (enabled("iterate/compacted"))
+            add("iterate/compacted", benchmark::measure<list>(opts, size * passes, compacted, walk));
+        if (enabled("compact"))
+            add("compact", benchmark::measure<list>(opts, size, fragmented, [](list &l) { l.compact(); }));
+    }
+
+    report.write(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <random>
+
+#include "../doubly_linked_list.hpp"
+#include "../singly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file dispatch_benchmark.cpp
+ * @brief Compares virtual dispatch through `linkedlist<int> &` with static dispatch.
+ *
+ * Each case runs the same tight loop twice: once in a function taking the
+ * type-erased `linkedlist<int> &`, and once in a function template taking the
+ * concrete, `final` list type (constrained on `list_type` under C++20). Both
+ * functions are kept out of line, as they would be in a separate translation
+ * unit, so the only difference is whether the calls can be resolved and
+ * inlined at compile time.
+ *
+ * Usage: `dispatch_benchmark [--max-size N] [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define NOINLINE __attribute__((noinline))
+#else
+    #define NOINLINE
+#endif
+
+// Lists are kept short so the call, not the walk, dominates contains and subscript
+static const size_t max_list_size = 1000;
+
+NOINLINE void append_virtual(linkedlist<int> &list, const std::vector<int> &values)
+{
+    for (int value: values)
+        list.append(value);
+}
+
+template <LIST_TYPE L>
+NOINLINE void append_static(L &list, const std::vector<int> &values)
+{
+    for (int value: values)
+        list.append(value);
+}
+
+NOINLINE size_t contains_virtual(const linkedlist<int> &list, const std::vector<int> &probes)
+{
+    size_t found = 0;
+    for (int value: probes)
+        found += list.contains(value);
+
+    return found;
+}
+
+template <LIST_TYPE L>
+NOINLINE size_t contains_static(const L &list, const std::vector<int> &probes)
+{
+    size_t found = 0;
+    for (int value: probes)
+        found += list.contains(value);
+
+    return found;
+}
+
+NOINLINE long subscript_virtual(linkedlist<int> &list, size_t times)
+{
+    long sum = 0;
+    for (size_t i = 0; i < times; i++)
+        sum += list[0];
+
+    return sum;
+}
+
+template <LIST_TYPE L>
+NOINLINE long subscript_static(L &list, size_t times)
+{
+    long sum = 0;
+    for (size_t i = 0; i < times; i++)
+        sum += list[0];
+
+    return sum;
+}
+
+/**
+ * @brief Runs every case for list type `L` at one size.
+ */
+template <typename L>
+void run_cases(benchmark::report &report, const benchmark::options &opts, const char *name, const std::vector<int> &values, const std::vector<int> &probes)
+{
+    const size_t size = values.size();
+    auto enabled = [&](const std::string &name)
+    {
+        return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+    };
+    auto add = [&](const char *op, const char *dispatch, benchmark::result res)
+    {
+        res.name = std::string(op) + "/" + dispatch;
+        res.container = name;
+        res.size = size;
+        report.add(res);
+    };
+    auto no_setup = [](L &) {};
+    auto fill = [&](L &list) { list.extend(values); };
+
+    if (enabled("append"))
+    {
+        add("append", "virtual", benchmark::measure<L>(opts, size, no_setup, [&](L &list) { append_virtual(list, values); }));
+        add("append", "static", benchmark::measure<L>(opts, size, no_setup, [&](L &list) { append_static(list, values); }));
+    }
+
+    if (enabled("contains") && size <= max_list_size)
+    {
+        add("contains", "virtual", benchmark::measure<L>(opts, probes.size(), fill,
+            [&](L &list) { benchmark::keep(contains_virtual(list, probes)); }));
+        add("contains", "static", benchmark::measure<L>(opts, probes.size(), fill,
+            [&](L &list) { benchmark::keep(contains_static(list, probes)); }));
+    }
+
+    if (enabled("subscript"))
+    {
+        add("subscript", "virtual", benchmark::measure<L>(opts, size, fill,
+            [&](L &list) { benchmark::keep(subscript_virtual(list, size)); }));
+        add("subscript", "static", benchmark::measure<L>(opts, size, fill,
+            [&](L &list) { benchmark::keep(subscript_static(list, size)); }));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("dispatch");
+
+    std::mt19937 rng(42);
+    std::vector<size_t> sizes = benchmark::sizes(opts);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        std::vector<int> values(sizes[i]), probes(1000);
+        for (size_t j = 0; j < values.size(); j++)
+            values[j] = (int)j;
+
+        std::uniform_int_distribution<int> pick(0, (int)(2 * sizes[i]));
+        for (size_t j = 0; j < probes.size(); j++)
+            probes[j] = pick(rng);
+
+        run_cases<singly_linked_list<int>>(report, opts, "singly_linked_list", values, probes);
+        run_cases<doubly_linked_list<int>>(report, opts, "doubly_linked_list", values, probes);
+    }
+
+    report.write(std::cout);
+
+    return 0;
+}
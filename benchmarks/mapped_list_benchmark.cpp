@@ -0,0 +1,103 @@
+#include <cstdio>
+#include <memory>
+
+#include "../singly_linked_list.hpp"
+#include "../mapped_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file mapped_list_benchmark.cpp
+ * @brief Compares reopening a mapped_linked_list with rebuilding a list from a vector.
+ *
+ * `rebuild` builds a singly_linked_list<int> from a std::vector<int>, the cold
+ * start of a list that is not persisted. `build_mapped` writes the same values
+ * to a fresh mapped_linked_list<int> and syncs it. `reopen` opens the file and
+ * reads the size, first and last value; `reopen_traverse` opens it and sums
+ * every value. The file stays in the page cache between runs, so the reopen
+ * cases show the cost of mapping and paging in, not of reading the disk.
+ *
+ * Usage: `mapped_list_benchmark [--max-size N] [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+typedef singly_linked_list<int> list;
+typedef std::unique_ptr<mapped_linked_list<int>> mapped;
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("mapped_list");
+
+    const std::string path = "mapped_list_benchmark.list";
+
+    std::vector<size_t> sizes = benchmark::sizes(opts);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        const size_t size = sizes[i];
+        std::vector<int> values(size);
+        for (size_t j = 0; j < size; j++)
+            values[j] = (int)j;
+
+        auto enabled = [&](const std::string &name)
+        {
+            return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+        };
+        auto add = [&](const std::string &name, const std::string &container, benchmark::result res)
+        {
+            res.name = name;
+            res.container = container;
+            res.size = size;
+            report.add(res);
+        };
+        auto create = [&](mapped &m)
+        {
+            std::remove(path.c_str());
+            m.reset(new mapped_linked_list<int>(path));
+        };
+        auto none = [](mapped &) {};
+
+        if (enabled("rebuild"))
+            add("rebuild", "singly_linked_list<int>", benchmark::measure<list>(opts, size, [](list &) {}, [&](list &l) { l.extend(values); }));
+
+        if (enabled("build_mapped"))
+            add("build_mapped", "mapped_linked_list<int>", benchmark::measure<mapped>(opts, size, create, [&](mapped &m)
+            {
+                m->extend(values);
+                m->sync();
+            }));
+
+        {
+            mapped_linked_list<int> file(path);
+            file.clear();
+            file.extend(values);
+            file.sync();
+        }
+
+        if (enabled("reopen"))
+            add("reopen", "mapped_linked_list<int>", benchmark::measure<mapped>(opts, size, none, [&](mapped &m)
+            {
+                m.reset(new mapped_linked_list<int>(path));
+                benchmark::keep(m->size());
+                benchmark::keep((*m)[0]);
+                benchmark::keep((*m)[-1]);
+            }));
+
+        if (enabled("reopen_traverse"))
+            add("reopen_traverse", "mapped_linked_list<int>", benchmark::measure<mapped>(opts, size, none, [&](mapped &m)
+            {
+                m.reset(new mapped_linked_list<int>(path));
+                long long sum = 0;
+                for (const int &value: *m)
+                    sum += value;
+                benchmark::keep(sum);
+            }));
+    }
+
+    std::remove(path.c_str());
+    report.write(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include "../singly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file parallel_build_benchmark.cpp
+ * @brief Measures building a singly_linked_list from a vector on 1 to 16 threads.
+ *
+ * `append` builds the list one node at a time, as extend() does for small or
+ * non-trivially-copyable inputs. `extend_parallel/N` builds it with
+ * extend_parallel() on N threads. Inputs too small to give every thread 2^16
+ * values use fewer threads, so the thread counts only diverge from 2^17 values
+ * up; run `make benchmark-full` for the 10^7 and 10^8 sizes that matter for
+ * bulk loads. Scaling is limited by the cores of the machine it runs on.
+ *
+ * Usage: `parallel_build_benchmark [--max-size N] [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+typedef singly_linked_list<int> list;
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("parallel_build");
+
+    const size_t thread_counts[] = {1, 2, 4, 8, 16};
+
+    std::vector<size_t> sizes = benchmark::sizes(opts);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        const size_t size = sizes[i];
+        std::vector<int> values(size);
+        for (size_t j = 0; j < size; j++)
+            values[j] = (int)j;
+
+        auto enabled = [&](const std::string &name)
+        {
+            return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+        };
+        auto add = [&](const std::string &name, benchmark::result res)
+        {
+            res.name = name;
+            res.container = "singly_linked_list<int>";
+            res.size = size;
+            report.add(res);
+        };
+        auto empty = [](list &) {};
+
+        if (enabled("append"))
+            add("append", benchmark::measure<list>(opts, size, empty, [&](list &l)
+            {
+                for (size_t j = 0; j < size; j++)
+                    l.append(values[j]);
+            }));
+
+        for (size_t threads: thread_counts)
+        {
+            const std::string name = "extend_parallel/" + std::to_string(threads);
+            if (enabled(name))
+                add(name, benchmark::measure<list>(opts, size, empty, [&](list &l) { l.extend_parallel(values, threads); }));
+        }
+    }
+
+    report.write(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <random>
+
+#include "../singly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file radix_sort_benchmark.cpp
+ * @brief Compares radix_sort() with the comparison sort() of a singly_linked_list.
+ *
+ * Each element type is sorted from the same shuffled input by both methods:
+ * `int` uniform over its whole range, `uint64_t` millisecond timestamps spread
+ * over a day, the common case for our large sorts, and `double` uniform in
+ * [-1e6, 1e6). Run `make benchmark-full` for the 10^7 and 10^8 sizes.
+ *
+ * Usage: `radix_sort_benchmark [--max-size N] [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+/**
+ * @brief Benchmarks both sorts of one element type at every size.
+ *
+ * @param opts The benchmark options.
+ * @param report The report the results are added to.
+ * @param container The container name recorded in the results.
+ * @param generate Callable returning the next random value, `T(std::mt19937_64 &)`.
+ */
+template <typename T, typename Generate>
+void run(const benchmark::options &opts, benchmark::report &report, const char *container, Generate generate)
+{
+    typedef singly_linked_list<T> list;
+
+    std::mt19937_64 rng(42);
+    std::vector<size_t> sizes = benchmark::sizes(opts);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        const size_t size = sizes[i];
+        std::vector<T> values(size);
+        for (size_t j = 0; j < size; j++)
+            values[j] = generate(rng);
+
+        auto enabled = [&](const std::string &name)
+        {
+            return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+        };
+        auto add = [&](const char *name, benchmark::result res)
+        {
+            res.name = name;
+            res.container = container;
+            res.size = size;
+            report.add(res);
+        };
+        auto fill = [&](list &l) { l.extend(values); };
+
+        if (enabled("sort"))
+            add("sort", benchmark::measure<list>(opts, size, fill, [](list &l) { l.sort(); }));
+        if (enabled("radix_sort"))
+            add("radix_sort", benchmark::measure<list>(opts, size, fill, [](list &l) { l.radix_sort(); }));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("radix_sort");
+
+    run<int>(opts, report, "singly_linked_list<int>", [](std::mt19937_64 &rng) { return (int)rng(); });
+    run<uint64_t>(opts, report, "singly_linked_list<uint64_t>/timestamps", [](std::mt19937_64 &rng) { return (uint64_t)1700000000000ULL + rng() % 86400000ULL; });
+    run<double>(opts, report, "singly_linked_list<double>", [](std::mt19937_64 &rng) { return std::uniform_real_distribution<double>(-1e6, 1e6)(rng); });
+
+    report.write(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,455 @@
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <sstream>
+
+#include "../singly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file singly_linked_list_benchmark.cpp
+ * @brief Benchmarks every singly_linked_list operation against the standard containers.
+ *
+ * Each case runs for `singly_linked_list<int>`, `std::forward_list<int>`,
+ * `std::list<int>` and `std::vector<int>` at every decade size in the requested
+ * range. Operations that cost O(1) are repeated `size` times per run; operations
+ * that walk the container are repeated a fixed number of times per run.
+ *
+ * Usage: `singly_linked_list_benchmark [--max-size N] [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+// Operations that walk the container run this many times per timed run
+static const size_t walk_ops = 100;
+
+/**
+ * @brief Uniform operations over a container type, specialised per container.
+ */
+template <typename C>
+struct adapter;
+
+template <>
+struct adapter<singly_linked_list<int>>
+{
+    typedef singly_linked_list<int> list;
+
+    static const char *name() { return "singly_linked_list"; }
+
+    static size_t limit(const std::string &) { return (size_t)-1; }
+
+    static void fill(list &c, const std::vector<int> &values) { c.extend(values); }
+    static void construct(std::unique_ptr<list> &c, const std::vector<int> &values) { c.reset(new list(values)); }
+    static void append_all(list &c, const std::vector<int> &values) { for (int value: values) c.append(value); }
+    static void prepend_all(list &c, const std::vector<int> &values) { for (int value: values) c.prepend(value); }
+    static void insert_middle(list &c, int value) { c.insert((int64_t)(c.size() / 2), value); }
+    static void insert_in_order(list &c, int value) { c.insert_in_order(value); }
+    static int pop_back(list &c) { return c.pop(); }
+    static void remove(list &c, int value) { c.remove(value); }
+    static size_t remove_odd(list &c) { return c.remove_if([](int x) { return x % 2 != 0; }); }
+    static void erase_middle(list &c) { c.erase((int64_t)(c.size() / 4), (int64_t)(3 * c.size() / 4)); }
+    static size_t pop_front_n(list &c, size_t count, std::vector<int> &out) { return c.pop_front_n(count, out); }
+    static void sort(list &c) { c.sort(); }
+    static void reverse(list &c) { c.reverse(); }
+    static void track_order(list &c) { c.set_order_tracking(true); }
+    static bool contains(const list &c, int value) { return c.contains(value); }
+    static size_t count(const list &c, int value) { return c.count(value); }
+    static int64_t index(const list &c, int value) { return c.index(value); }
+    static std::vector<int> to_vector(list &c) { return c; }
+    static int *to_array(list &c) { return c; }
+    static std::string to_string(list &c) { return c.to_string(); }
+};
+
+template <typename C>
+struct std_adapter
+{
+    static size_t limit(const std::string &) { return (size_t)-1; }
+
+    static void track_order(C &) {}
+    static void construct(std::unique_ptr<C> &c, const std::vector<int> &values) { c.reset(new C(values.begin(), values.end())); }
+    static bool contains(const C &c, int value) { return std::find(c.begin(), c.end(), value) != c.end(); }
+    static size_t count(const C &c, int value) { return std::count(c.begin(), c.end(), value); }
+    static int64_t index(const C &c, int value) { return std::distance(c.begin(), std::find(c.begin(), c.end(), value)); }
+    static std::vector<int> to_vector(C &c) { return std::vector<int>(c.begin(), c.end()); }
+
+    static int *to_array(C &c)
+    {
+        int *arr = new int[std::distance(c.begin(), c.end())];
+        std::copy(c.begin(), c.end(), arr);
+
+        return arr;
+    }
+
+    static std::string to_string(C &c)
+    {
+        std::ostringstream ss;
+        ss << "[";
+        for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+            ss << (it == c.begin() ? "" : ", ") << *it;
+        ss << "]";
+
+        return ss.str();
+    }
+};
+
+template <>
+struct adapter<std::forward_list<int>>: std_adapter<std::forward_list<int>>
+{
+    typedef std::forward_list<int> list;
+
+    static const char *name() { return "std::forward_list"; }
+
+    static void fill(list &c, const std::vector<int> &values) { c.assign(values.begin(), values.end()); }
+
+    static void append_all(list &c, const std::vector<int> &values)
+    {
+        list::iterator last = c.before_begin();
+        for (int value: values)
+            last = c.insert_after(last, value);
+    }
+
+    static void prepend_all(list &c, const std::vector<int> &values) { for (int value: values) c.push_front(value); }
+
+    static void insert_middle(list &c, int value)
+    {
+        list::iterator it = c.before_begin();
+        std::advance(it, std::distance(c.begin(), c.end()) / 2);
+        c.insert_after(it, value);
+    }
+
+    static void insert_in_order(list &c, int value)
+    {
+        list::iterator prev = c.before_begin();
+        for (list::iterator it = c.begin(); it != c.end() && *it < value; ++it)
+            prev = it;
+        c.insert_after(prev, value);
+    }
+
+    static int pop_back(list &c)
+    {
+        list::iterator prev = c.before_begin(), it = c.begin();
+        while (std::next(it) != c.end())
+            prev = it++;
+
+        int value = *it;
+        c.erase_after(prev);
+
+        return value;
+    }
+
+    static void remove(list &c, int value)
+    {
+        list::iterator prev = c.before_begin();
+        for (list::iterator it = c.begin(); it != c.end(); prev = it++)
+        {
+            if (*it == value)
+            {
+                c.erase_after(prev);
+                return;
+            }
+        }
+    }
+
+    static size_t pop_front_n(list &c, size_t count, std::vector<int> &out)
+    {
+        size_t popped = 0;
+        for (; popped < count && !c.empty(); popped++)
+        {
+            out.push_back(c.front());
+            c.pop_front();
+        }
+
+        return popped;
+    }
+
+    static void remove_odd(list &c) { c.remove_if([](int x) { return x % 2 != 0; }); }
+
+    static void erase_middle(list &c)
+    {
+        size_t size = std::distance(c.begin(), c.end());
+        list::iterator first = std::next(c.before_begin(), size / 4);
+        c.erase_after(first, std::next(first, 3 * size / 4 - size / 4 + 1));
+    }
+
+    static void sort(list &c) { c.sort(); }
+    static void reverse(list &c) { c.reverse(); }
+};
+
+template <>
+struct adapter<std::list<int>>: std_adapter<std::list<int>>
+{
+    typedef std::list<int> list;
+
+    static const char *name() { return "std::list"; }
+
+    static void fill(list &c, const std::vector<int> &values) { c.assign(values.begin(), values.end()); }
+    static void append_all(list &c, const std::vector<int> &values) { for (int value: values) c.push_back(value); }
+    static void prepend_all(list &c, const std::vector<int> &values) { for (int value: values) c.push_front(value); }
+    static void insert_middle(list &c, int value) { c.insert(std::next(c.begin(), c.size() / 2), value); }
+
+    static void insert_in_order(list &c, int value)
+    {
+        c.insert(std::find_if(c.begin(), c.end(), [value](int x) { return !(x < value); }), value);
+    }
+
+    static int pop_back(list &c)
+    {
+        int value = c.back();
+        c.pop_back();
+
+        return value;
+    }
+
+    static void remove(list &c, int value)
+    {
+        list::iterator it = std::find(c.begin(), c.end(), value);
+        if (it != c.end())
+            c.erase(it);
+    }
+
+    static void remove_odd(list &c) { c.remove_if([](int x) { return x % 2 != 0; }); }
+    static void erase_middle(list &c) { c.erase(std::next(c.begin(), c.size() / 4), std::next(c.begin(), 3 * c.size() / 4)); }
+
+    static size_t pop_front_n(list &c, size_t count, std::vector<int> &out)
+    {
+        size_t popped = 0;
+        for (; popped < count && !c.empty(); popped++)
+        {
+            out.push_back(c.front());
+            c.pop_front();
+        }
+
+        return popped;
+    }
+
+    static void sort(list &c) { c.sort(); }
+    static void reverse(list &c) { c.reverse(); }
+};
+
+template <>
+struct adapter<std::vector<int>>: std_adapter<std::vector<int>>
+{
+    typedef std::vector<int> list;
+
+    static const char *name() { return "std::vector"; }
+
+    // Popping from the front shifts the whole vector
+    static size_t limit(const std::string &name) { return name == "pop_front_n" ? 100000 : (size_t)-1; }
+
+    static void fill(list &c, const std::vector<int> &values) { c = values; }
+    static void append_all(list &c, const std::vector<int> &values) { for (int value: values) c.push_back(value); }
+    static void prepend_all(list &c, const std::vector<int> &values) { for (int value: values) c.insert(c.begin(), value); }
+    static void insert_middle(list &c, int value) { c.insert(c.begin() + c.size() / 2, value); }
+    static void insert_in_order(list &c, int value) { c.insert(std::lower_bound(c.begin(), c.end(), value), value); }
+
+    static int pop_back(list &c)
+    {
+        int value = c.back();
+        c.pop_back();
+
+        return value;
+    }
+
+    static void remove(list &c, int value)
+    {
+        list::iterator it = std::find(c.begin(), c.end(), value);
+        if (it != c.end())
+            c.erase(it);
+    }
+
+    static void remove_odd(list &c) { c.erase(std::remove_if(c.begin(), c.end(), [](int x) { return x % 2 != 0; }), c.end()); }
+    static void erase_middle(list &c) { c.erase(c.begin() + c.size() / 4, c.begin() + 3 * c.size() / 4); }
+
+    static size_t pop_front_n(list &c, size_t count, std::vector<int> &out)
+    {
+        size_t popped = std::min(count, c.size());
+        out.insert(out.end(), c.begin(), c.begin() + popped);
+        c.erase(c.begin(), c.begin() + popped);
+
+        return popped;
+    }
+
+    static void sort(list &c) { std::sort(c.begin(), c.end()); }
+    static void reverse(list &c) { std::reverse(c.begin(), c.end()); }
+};
+
+/**
+ * @brief Input shared by every container for one size.
+ */
+struct dataset
+{
+    std::vector<int> sequential; ///< 0, 1, ..., size - 1
+    std::vector<int> shuffled;   ///< A fixed permutation of `sequential`
+    std::vector<int> probes;     ///< `walk_ops` random values in [0, size)
+
+    dataset(size_t size): sequential(size)
+    {
+        std::mt19937 rng(42);
+        for (size_t i = 0; i < size; i++)
+            this->sequential[i] = (int)i;
+
+        this->shuffled = this->sequential;
+        std::shuffle(this->shuffled.begin(), this->shuffled.end(), rng);
+
+        std::uniform_int_distribution<int> pick(0, (int)size - 1);
+        for (size_t i = 0; i < walk_ops; i++)
+            this->probes.push_back(pick(rng));
+    }
+};
+
+/**
+ * @brief Runs every case for container `C` at one size.
+ */
+template <typename C>
+void run_cases(benchmark::report &report, const benchmark::options &opts, const dataset &data)
+{
+    typedef adapter<C> ops;
+
+    const size_t size = data.sequential.size();
+    const std::vector<int> &sequential = data.sequential, &shuffled = data.shuffled, &probes = data.probes;
+
+    std::vector<std::pair<std::string, benchmark::result>> results;
+    auto enabled = [&](const std::string &name)
+    {
+        return size <= ops::limit(name) && (opts.filter.empty() || name.find(opts.filter) != std::string::npos);
+    };
+    auto no_setup = [](C &) {};
+    auto fill_sequential = [&](C &c) { ops::fill(c, sequential); };
+    auto fill_shuffled = [&](C &c) { ops::fill(c, shuffled); };
+
+    if (enabled("construct_vector"))
+    {
+        typedef std::unique_ptr<C> built;
+        results.push_back(std::make_pair("construct_vector", benchmark::measure<built>(opts, size,
+            [](built &) {}, [&](built &c) { ops::construct(c, shuffled); })));
+    }
+
+    if (enabled("append"))
+        results.push_back(std::make_pair("append", benchmark::measure<C>(opts, size,
+            no_setup, [&](C &c) { ops::append_all(c, shuffled); })));
+
+    // Quadratic for std::vector, so cap its element count at the walk budget
+    if (enabled("prepend"))
+    {
+        const std::vector<int> &values = (ops::name() == std::string("std::vector") && size > 10000) ? probes : shuffled;
+        results.push_back(std::make_pair("prepend", benchmark::measure<C>(opts, values.size(),
+            no_setup, [&](C &c) { ops::prepend_all(c, values); })));
+    }
+
+    if (enabled("insert"))
+        results.push_back(std::make_pair("insert", benchmark::measure<C>(opts, walk_ops,
+            fill_shuffled, [&](C &c) { for (int value: probes) ops::insert_middle(c, value); })));
+
+    if (enabled("insert_in_order"))
+        results.push_back(std::make_pair("insert_in_order", benchmark::measure<C>(opts, walk_ops,
+            fill_sequential, [&](C &c) { for (int value: probes) ops::insert_in_order(c, value); })));
+
+    if (enabled("pop"))
+    {
+        const size_t pops = std::min(walk_ops, size);
+        results.push_back(std::make_pair("pop", benchmark::measure<C>(opts, pops,
+            fill_shuffled, [&](C &c) { for (size_t i = 0; i < pops; i++) benchmark::keep(ops::pop_back(c)); })));
+    }
+
+    // Removes values from the second half of a sequential list, never the head
+    if (enabled("remove"))
+    {
+        const size_t removals = std::min(walk_ops, size / 2);
+        results.push_back(std::make_pair("remove", benchmark::measure<C>(opts, removals,
+            fill_sequential, [&](C &c) { for (size_t i = 0; i < removals; i++) ops::remove(c, (int)(size / 2 + i)); })));
+    }
+
+    // Removes every odd value, half of the list, in one pass
+    if (enabled("remove_if"))
+        results.push_back(std::make_pair("remove_if", benchmark::measure<C>(opts, size,
+            fill_shuffled, [&](C &c) { ops::remove_odd(c); })));
+
+    // Removes the middle half of the list as one range
+    if (enabled("erase"))
+        results.push_back(std::make_pair("erase", benchmark::measure<C>(opts, size / 2,
+            fill_shuffled, [&](C &c) { ops::erase_middle(c); })));
+
+    // Drains the whole list in chunks of walk_ops values
+    if (enabled("pop_front_n"))
+    {
+        std::vector<int> chunk;
+        results.push_back(std::make_pair("pop_front_n", benchmark::measure<C>(opts, size,
+            fill_shuffled, [&](C &c) { do chunk.clear(); while (ops::pop_front_n(c, walk_ops, chunk) > 0); })));
+    }
+
+    if (enabled("sort"))
+        results.push_back(std::make_pair("sort", benchmark::measure<C>(opts, 1,
+            fill_shuffled, [&](C &c) { ops::sort(c); })));
+
+    // Input already in order, which the list notices without sorting
+    if (enabled("sort_sorted"))
+        results.push_back(std::make_pair("sort_sorted", benchmark::measure<C>(opts, 1,
+            fill_sequential, [&](C &c) { ops::sort(c); })));
+
+    if (enabled("reverse"))
+        results.push_back(std::make_pair("reverse", benchmark::measure<C>(opts, 1,
+            fill_shuffled, [&](C &c) { ops::reverse(c); })));
+
+    if (enabled("contains"))
+        results.push_back(std::make_pair("contains", benchmark::measure<C>(opts, walk_ops,
+            fill_shuffled, [&](C &c) { for (int value: probes) benchmark::keep(ops::contains(c, value)); })));
+
+    // Misses below the smallest value, which a list tracking its order gives up on at its head
+    if (enabled("contains_sorted"))
+        results.push_back(std::make_pair("contains_sorted", benchmark::measure<C>(opts, walk_ops,
+            [&](C &c) { ops::fill(c, sequential); ops::track_order(c); }, [&](C &c) { for (int value: probes) benchmark::keep(ops::contains(c, -value - 1)); })));
+
+    if (enabled("count"))
+        results.push_back(std::make_pair("count", benchmark::measure<C>(opts, walk_ops / 10,
+            fill_shuffled, [&](C &c) { for (size_t i = 0; i < walk_ops / 10; i++) benchmark::keep(ops::count(c, probes[i])); })));
+
+    if (enabled("index"))
+        results.push_back(std::make_pair("index", benchmark::measure<C>(opts, walk_ops,
+            fill_shuffled, [&](C &c) { for (int value: probes) benchmark::keep(ops::index(c, value)); })));
+
+    if (enabled("to_vector"))
+        results.push_back(std::make_pair("to_vector", benchmark::measure<C>(opts, 1,
+            fill_shuffled, [&](C &c) { benchmark::keep(ops::to_vector(c)); })));
+
+    if (enabled("to_array"))
+        results.push_back(std::make_pair("to_array", benchmark::measure<C>(opts, 1,
+            fill_shuffled, [&](C &c) { int *arr = ops::to_array(c); benchmark::keep(arr); delete[] arr; })));
+
+    if (enabled("to_string"))
+        results.push_back(std::make_pair("to_string", benchmark::measure<C>(opts, 1,
+            fill_shuffled, [&](C &c) { benchmark::keep(ops::to_string(c)); })));
+
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        results[i].second.name = results[i].first;
+        results[i].second.container = ops::name();
+        results[i].second.size = size;
+        report.add(results[i].second);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("singly_linked_list");
+
+    std::vector<size_t> sizes = benchmark::sizes(opts);
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        dataset data(sizes[i]);
+
+        run_cases<singly_linked_list<int>>(report, opts, data);
+        run_cases<std::forward_list<int>>(report, opts, data);
+        run_cases<std::list<int>>(report, opts, data);
+        run_cases<std::vector<int>>(report, opts, data);
+    }
+
+    report.write(std::cout);
+
+    return 0;
+}
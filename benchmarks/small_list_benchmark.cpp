@@ -0,0 +1,142 @@
+#include "../singly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file small_list_benchmark.cpp
+ * @brief Measures small singly_linked_lists with and without inline node slots.
+ *
+ * Every case works on a batch of lists of 1 to 16 values, and `ns_per_op` is
+ * the time per list. `build` appends the values to empty lists; `build_drain`
+ * also pops them all again, so it includes freeing the nodes; `traverse` sums
+ * the values of lists built beforehand. The lists keep 0, 8 or 16 nodes inline.
+ * The sizes are fixed, so `--min-size` and `--max-size` are ignored. The heap
+ * allocations needed to build one list of each size go to stderr.
+ *
+ * Usage: `small_list_benchmark [--filter NAME] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+static size_t allocations = 0;
+
+/**
+ * @brief A std::allocator that counts its allocations.
+ */
+template <typename T>
+struct counting_allocator: std::allocator<T>
+{
+    typedef T value_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(size_t count)
+    {
+        allocations++;
+        return std::allocator<T>::allocate(count);
+    }
+};
+
+/**
+ * @brief Counts the heap allocations made to build one list of `size` values.
+ */
+template <size_t Inline>
+size_t count_allocations(const size_t &size)
+{
+    allocations = 0;
+    singly_linked_list<int, counting_allocator<int>, Inline> list;
+    for (size_t i = 0; i < size; i++)
+        list.append((int)i);
+
+    return allocations;
+}
+
+template <size_t Inline>
+void run(const benchmark::options &opts, benchmark::report &report, const size_t &size)
+{
+    typedef singly_linked_list<int, std::allocator<int>, Inline> list;
+    typedef std::vector<list> batch;
+    const size_t lists = 1000;
+
+    auto enabled = [&](const std::string &name)
+    {
+        return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+    };
+    auto add = [&](const std::string &name, benchmark::result res)
+    {
+        res.name = name;
+        res.container = "singly_linked_list<int, std::allocator<int>, " + std::to_string(Inline) + ">";
+        res.size = size;
+        report.add(res);
+    };
+    auto empty = [&](batch &b) { b.resize(lists); };
+    auto filled = [&](batch &b)
+    {
+        b.resize(lists);
+        for (list &l: b)
+            for (size_t i = 0; i < size; i++)
+                l.append((int)i);
+    };
+
+    if (enabled("build"))
+        add("build", benchmark::measure<batch>(opts, lists, empty, [&](batch &b)
+        {
+            for (list &l: b)
+                for (size_t i = 0; i < size; i++)
+                    l.append((int)i);
+        }));
+
+    if (enabled("build_drain"))
+        add("build_drain", benchmark::measure<batch>(opts, lists, empty, [&](batch &b)
+        {
+            for (list &l: b)
+            {
+                for (size_t i = 0; i < size; i++)
+                    l.append((int)i);
+                for (size_t i = 0; i < size; i++)
+                    benchmark::keep(l.pop(0));
+            }
+        }));
+
+    if (enabled("traverse"))
+        add("traverse", benchmark::measure<batch>(opts, lists, filled, [&](batch &b)
+        {
+            long long sum = 0;
+            for (const list &l: b)
+                for (const int &value: l)
+                    sum += value;
+            benchmark::keep(sum);
+        }));
+}
+
+int main(int argc, char **argv)
+{
+    benchmark::options opts = benchmark::parse(argc, argv);
+    benchmark::report report("small_list");
+
+    std::cerr << "allocations per list (size: inline 0 / 8 / 16)" << std::endl;
+    for (size_t size = 1; size <= 16; size++)
+        std::cerr << size << ": " << count_allocations<0>(size) << " / " << count_allocations<8>(size)
+                  << " / " << count_allocations<16>(size) << std::endl;
+
+    for (size_t size = 1; size <= 16; size++)
+    {
+        run<0>(opts, report, size);
+        run<8>(opts, report, size);
+        run<16>(opts, report, size);
+    }
+
+    report.write(std::cout);
+
+    return 0;
+}
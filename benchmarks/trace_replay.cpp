@@ -0,0 +1,111 @@
+#include "../singly_linked_list.hpp"
+#include "../doubly_linked_list.hpp"
+#include "./benchmark.hpp"
+
+/**
+ * @file trace_replay.cpp
+ * @brief Replays a recorded list trace and reports throughput and latency per operation.
+ *
+ * The trace is one written by a `list_trace` attached to a singly_linked_list
+ * (see trace.hpp). Its calls are made in order on a fresh list of the recorded
+ * value type, so a production workload can be timed against either list type,
+ * or before and after a change to the lists. Every operation in the trace
+ * becomes one result whose `ops` is its call count; the percentiles go to
+ * stderr with the summary.
+ *
+ * Usage: `trace_replay TRACE [--list singly|doubly] > results.json`
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+template <typename A>
+int replay(const std::string &path, const std::string &list_type, const std::string &type_name)
+{
+    trace_report result;
+    std::string container;
+    if (list_type == "doubly")
+    {
+        doubly_linked_list<A> list;
+        result = replay_trace(path, list);
+        container = "doubly_linked_list<" + type_name + ">";
+    }
+    else if (list_type == "singly")
+    {
+        singly_linked_list<A> list;
+        result = replay_trace(path, list);
+        container = "singly_linked_list<" + type_name + ">";
+    }
+    else
+    {
+        std::cerr << "Unknown list type " << list_type << std::endl;
+        return 1;
+    }
+
+    benchmark::report report("trace_replay");
+    for (size_t i = 0; i < TRACE_OPS; i++)
+    {
+        if (result.calls[i] == 0)
+            continue;
+
+        benchmark::result res = benchmark::result();
+        res.name = list_trace::name((trace_op)i);
+        res.container = container;
+        res.ops = result.calls[i];
+        res.runs = 1;
+        res.total_ns = result.total_ns[i];
+        report.add(res);
+    }
+    std::cerr << result << std::endl;
+    report.write(std::cout);
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " TRACE [--list singly|doubly]" << std::endl;
+        return 1;
+    }
+
+    const std::string path = argv[1];
+    std::string list_type = "singly";
+    for (int i = 2; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--list") == 0)
+            list_type = argv[i + 1];
+        else
+            std::cerr << "Ignoring unknown option " << argv[i] << std::endl;
+    }
+
+    try
+    {
+        list_trace_reader header(path);
+        const uint8_t kind = header.kind();
+        const size_t size = header.value_size();
+
+        if (kind == list_trace::kind<int32_t>() && size == 4)
+            return replay<int32_t>(path, list_type, "int32_t");
+        if (kind == list_trace::kind<int64_t>() && size == 8)
+            return replay<int64_t>(path, list_type, "int64_t");
+        if (kind == list_trace::kind<uint32_t>() && size == 4)
+            return replay<uint32_t>(path, list_type, "uint32_t");
+        if (kind == list_trace::kind<uint64_t>() && size == 8)
+            return replay<uint64_t>(path, list_type, "uint64_t");
+        if (kind == list_trace::kind<float>() && size == sizeof(float))
+            return replay<float>(path, list_type, "float");
+        if (kind == list_trace::kind<double>() && size == sizeof(double))
+            return replay<double>(path, list_type, "double");
+
+        std::cerr << "Traces of " << size << "-byte values of kind " << (int)kind << " cannot be replayed here" << std::endl;
+    }
+    catch (const Exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+
+    return 1;
+}
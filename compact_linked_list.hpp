@@ -0,0 +1,212 @@
+#if __cplusplus >= 201103L
+
+#ifndef COMPACT_LINKED_LIST_H
+#define COMPACT_LINKED_LIST_H
+
+#include <cstdint>
+
+#include "./linkedlist.hpp"
+
+/**
+ * @brief A singly linked list whose nodes live in a pool and link by 32-bit index.
+ *
+ * Values and links are kept in two parallel arrays, so a node costs
+ * `sizeof(A) + 4` bytes with no padding. A `singly_linked_list<int>` node
+ * takes 16 bytes on 64-bit builds; here it takes 8. Removed slots go on a free
+ * list and are reused; compact() lays the list out in order and returns the
+ * spare slots. The pool grows like a `std::vector`, so adding a value can move
+ * the stored values, and references to them do not survive it. Iterators hold
+ * slot indices and do survive it. A list holds fewer than 2^32 values.
+ *
+ * Unlike the other lists, which share their nodes between copies until one is
+ * released, a copy of a compact_linked_list owns a pool of its own: copying
+ * takes O(n) time and memory, and changes to one copy are not seen by the other.
+ *
+ * @tparam A The value type.
+ * @tparam Allocator The allocator the pool is obtained from.
+ */
+template <typename A, typename Allocator = std::allocator<A>>
+class compact_linked_list final: public static_list<compact_linked_list<A, Allocator>>
+{
+    private:
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<uint32_t> link_allocator;
+
+        static constexpr uint32_t nil = UINT32_MAX;
+
+        std::vector<A, Allocator> values;
+        std::vector<uint32_t, link_allocator> links;
+        uint32_t head, tail, unused;
+        size_t length;
+
+        uint32_t getslot(const int64_t &index) const;
+        uint32_t acquire(const A &value);
+        A unlink(uint32_t prev, uint32_t index);
+        void relayout(std::vector<A, Allocator> &&ordered);
+    public:
+        typedef A value_type;
+        typedef Allocator allocator_type;
+
+        class iterator
+        {
+            private:
+                compact_linked_list<A, Allocator> *list;
+                uint32_t index;
+
+                iterator(compact_linked_list<A, Allocator> *list, uint32_t index);
+
+                friend class compact_linked_list<A, Allocator>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef A *pointer;
+                typedef A &reference;
+
+                iterator();
+
+                iterator &operator++();
+                iterator operator++(int);
+                A &operator*() const;
+                A *operator->() const;
+                bool operator==(const iterator &it) const;
+                bool operator!=(const iterator &it) const;
+        };
+
+        class const_iterator
+        {
+            private:
+                const compact_linked_list<A, Allocator> *list;
+                uint32_t index;
+
+                const_iterator(const compact_linked_list<A, Allocator> *list, uint32_t index);
+
+                friend class compact_linked_list<A, Allocator>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const A *pointer;
+                typedef const A &reference;
+
+                const_iterator();
+                const_iterator(const iterator &it);
+
+                const_iterator &operator++();
+                const_iterator operator++(int);
+                const A &operator*() const;
+                const A *operator->() const;
+                bool operator==(const const_iterator &it) const;
+                bool operator!=(const const_iterator &it) const;
+        };
+
+        compact_linked_list();
+        explicit compact_linked_list(const Allocator &alloc);
+
+        compact_linked_list(compact_linked_list<A, Allocator> &&obj);
+        compact_linked_list(const compact_linked_list<A, Allocator> &obj);
+        compact_linked_list(const std::initializer_list<A> &values, const Allocator &alloc = Allocator());
+
+        template <size_t N>
+        compact_linked_list(const A (&array)[N], const Allocator &alloc = Allocator());
+        compact_linked_list(const std::vector<A> &values, const Allocator &alloc = Allocator());
+        explicit compact_linked_list(const linkedlist<A, Allocator> &obj);
+
+        compact_linked_list<A, Allocator> &operator=(compact_linked_list<A, Allocator> &&obj);
+        compact_linked_list<A, Allocator> &operator=(const compact_linked_list<A, Allocator> &obj);
+
+        void prepend(const A &value);
+        void append(const A &value);
+        void insert(const int64_t &index, const A &value);
+        void insert_in_order(const A &value);
+
+        void extend(const std::initializer_list<A> &values);
+
+        template <size_t N>
+        void extend(const A (&array)[N]);
+        void extend(const std::vector<A> &values);
+
+        void remove(const A &value);
+        A pop(const int64_t &index);
+        A pop();
+
+        size_t size() const;
+        bool isempty() const;
+
+        bool contains(const A &value) const;
+        int64_t index(const A &value) const;
+        size_t count(const A &value) const;
+
+        void reverse();
+        void sort();
+
+        void reserve(const size_t &capacity);
+        size_t capacity() const;
+        void compact();
+        list_memory memory_usage() const;
+
+        A &operator[](const int64_t &index);
+        const A &operator[](const int64_t &index) const;
+
+        bool operator>(const compact_linked_list<A, Allocator> &obj) const;
+        bool operator<(const compact_linked_list<A, Allocator> &obj) const;
+        bool operator>=(const compact_linked_list<A, Allocator> &obj) const;
+        bool operator<=(const compact_linked_list<A, Allocator> &obj) const;
+        bool operator==(const compact_linked_list<A, Allocator> &obj) const;
+        bool operator!=(const compact_linked_list<A, Allocator> &obj) const;
+
+        operator std::vector<A>() const;
+
+        std::string to_string() const;
+        void show() const;
+
+        void clear();
+
+        allocator_type get_allocator() const;
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        template <typename B, typename C>
+        friend B min(const compact_linked_list<B, C> &obj);
+
+        template <typename B, typename C>
+        friend B max(const compact_linked_list<B, C> &obj);
+
+        template <typename B, typename C>
+        friend std::ostream &operator<<(std::ostream &out, const compact_linked_list<B, C> &obj);
+};
+
+template <typename A, typename Allocator>
+A min(const compact_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+A max(const compact_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+size_t len(const compact_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+std::ostream &operator<<(std::ostream &out, const compact_linked_list<A, Allocator> &obj);
+
+#if __cplusplus >= 201703L && defined(__has_include)
+    #if __has_include(<memory_resource>)
+        namespace pmr
+        {
+            template <typename A>
+            using compact_linked_list = ::compact_linked_list<A, std::pmr::polymorphic_allocator<A>>;
+        }
+    #endif
+#endif
+
+#include "./compact_linked_list.tpp"
+
+#endif
+
+#else
+    #error "Requires C++11 or later.\n"
+
+#endif
@@ -0,0 +1,1150 @@
+#include "./compact_linked_list.hpp"
+
+
+#if __cplusplus < 201703L
+template <typename A, typename Allocator>
+constexpr uint32_t compact_linked_list<A, Allocator>::nil;
+#endif
+
+/**
+ * @brief Default constructor for the iterator.
+ *
+ * Initializes an iterator that points past the end of no list.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::iterator::iterator():
+    list(nullptr), index(nil) {}
+
+/**
+ * @brief Constructor for the iterator.
+ *
+ * @param list The list the iterator walks.
+ * @param index The slot the iterator will point to, nil for the end.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::iterator::iterator(compact_linked_list<A, Allocator> *list, uint32_t index):
+    list(list), index(index) {}
+
+/**
+ * @brief Prefix increment operator for the iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::iterator &compact_linked_list<A, Allocator>::iterator::operator++()
+{
+    this->index = this->list->links[this->index];
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::iterator compact_linked_list<A, Allocator>::iterator::operator++(int)
+{
+    iterator it = *this;
+    this->index = this->list->links[this->index];
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the iterator.
+ *
+ * @return A reference to the value the iterator points to.
+ */
+template <typename A, typename Allocator>
+A &compact_linked_list<A, Allocator>::iterator::operator*() const
+{
+    return this->list->values[this->index];
+}
+
+/**
+ * @brief Member access operator for the iterator.
+ *
+ * @return A pointer to the value the iterator points to.
+ */
+template <typename A, typename Allocator>
+A *compact_linked_list<A, Allocator>::iterator::operator->() const
+{
+    return &this->list->values[this->index];
+}
+
+/**
+ * @brief Equality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both iterators point to the same slot, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::iterator::operator==(const iterator &it) const
+{
+    return this->index == it.index;
+}
+
+/**
+ * @brief Inequality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the iterators point to different slots, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::iterator::operator!=(const iterator &it) const
+{
+    return this->index != it.index;
+}
+
+/**
+ * @brief Default constructor for the const_iterator.
+ *
+ * Initializes a const_iterator that points past the end of no list.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::const_iterator::const_iterator():
+    list(nullptr), index(nil) {}
+
+/**
+ * @brief Constructor for the const_iterator.
+ *
+ * @param list The list the const_iterator walks.
+ * @param index The slot the const_iterator will point to, nil for the end.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::const_iterator::const_iterator(const compact_linked_list<A, Allocator> *list, uint32_t index):
+    list(list), index(index) {}
+
+/**
+ * @brief Converts an iterator to a const_iterator at the same slot.
+ *
+ * @param it The iterator to convert.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::const_iterator::const_iterator(const iterator &it):
+    list(it.list), index(it.index) {}
+
+/**
+ * @brief Prefix increment operator for the const_iterator.
+ *
+ * @return A reference to the updated const_iterator.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::const_iterator &compact_linked_list<A, Allocator>::const_iterator::operator++()
+{
+    this->index = this->list->links[this->index];
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the const_iterator.
+ *
+ * @return A copy of the const_iterator before incrementing.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::const_iterator compact_linked_list<A, Allocator>::const_iterator::operator++(int)
+{
+    const_iterator it = *this;
+    this->index = this->list->links[this->index];
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the const_iterator.
+ *
+ * @return A const reference to the value the const_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A &compact_linked_list<A, Allocator>::const_iterator::operator*() const
+{
+    return this->list->values[this->index];
+}
+
+/**
+ * @brief Member access operator for the const_iterator.
+ *
+ * @return A pointer to the value the const_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A *compact_linked_list<A, Allocator>::const_iterator::operator->() const
+{
+    return &this->list->values[this->index];
+}
+
+/**
+ * @brief Equality operator for the const_iterator.
+ *
+ * @param it The const_iterator to compare with.
+ * @return true If both const_iterators point to the same slot, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::const_iterator::operator==(const const_iterator &it) const
+{
+    return this->index == it.index;
+}
+
+/**
+ * @brief Inequality operator for the const_iterator.
+ *
+ * @param it The const_iterator to compare with.
+ * @return true If the const_iterators point to different slots, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::const_iterator::operator!=(const const_iterator &it) const
+{
+    return this->index != it.index;
+}
+
+/**
+ * @brief Default constructor for compact_linked_list.
+ *
+ * No pool is allocated until a value is added.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list():
+    compact_linked_list<A, Allocator>(Allocator()) {}
+
+/**
+ * @brief Constructor for an empty compact_linked_list using a given allocator.
+ * @param alloc The allocator the pool is obtained from.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list(const Allocator &alloc):
+    values(alloc), links(link_allocator(alloc)), head(nil), tail(nil), unused(nil), length(0) {}
+
+/**
+ * @brief Move constructor, leaving `obj` empty.
+ * @param obj The list to move from.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list(compact_linked_list<A, Allocator> &&obj):
+    values(std::move(obj.values)), links(std::move(obj.links)), head(obj.head), tail(obj.tail), unused(obj.unused), length(obj.length)
+{
+    obj.clear();
+}
+
+/**
+ * @brief Copy constructor.
+ *
+ * Copies every value into a pool of its own, rather than sharing the nodes of
+ * `obj` as `singly_linked_list` does, so the two lists change independently.
+ * The copy is laid out in order, without the spare slots of `obj`.
+ *
+ * @param obj The list to copy.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list(const compact_linked_list<A, Allocator> &obj):
+    compact_linked_list<A, Allocator>(std::allocator_traits<Allocator>::select_on_container_copy_construction(obj.get_allocator()))
+{
+    this->reserve(obj.length);
+    for (const A &value: obj)
+        this->append(value);
+}
+
+/**
+ * @brief Constructor from an initializer list.
+ * @param values The values of the list, in order.
+ * @param alloc The allocator the pool is obtained from.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list(const std::initializer_list<A> &values, const Allocator &alloc):
+    compact_linked_list<A, Allocator>(alloc)
+{
+    this->extend(values);
+}
+
+/**
+ * @brief Constructor from a C-style array.
+ * @param array The values of the list, in order.
+ * @param alloc The allocator the pool is obtained from.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+compact_linked_list<A, Allocator>::compact_linked_list(const A (&array)[N], const Allocator &alloc):
+    compact_linked_list<A, Allocator>(alloc)
+{
+    this->extend(array);
+}
+
+/**
+ * @brief Constructor from a vector.
+ * @param values The values of the list, in order.
+ * @param alloc The allocator the pool is obtained from.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list(const std::vector<A> &values, const Allocator &alloc):
+    compact_linked_list<A, Allocator>(alloc)
+{
+    this->extend(values);
+}
+
+/**
+ * @brief Builds a compact copy of another list.
+ * @param obj The list to copy, for example a `singly_linked_list`.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::compact_linked_list(const linkedlist<A, Allocator> &obj):
+    compact_linked_list<A, Allocator>(obj.get_allocator())
+{
+    this->reserve(obj.size());
+    this->append_range(obj.cbegin(), obj.cend());
+}
+
+/**
+ * @brief Move assignment operator.
+ * @param obj The list to move from, left empty.
+ * @return A reference to this list.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator> &compact_linked_list<A, Allocator>::operator=(compact_linked_list<A, Allocator> &&obj)
+{
+    if (this == &obj)
+        return *this;
+
+    this->values = std::move(obj.values);
+    this->links = std::move(obj.links);
+    this->head = obj.head;
+    this->tail = obj.tail;
+    this->unused = obj.unused;
+    this->length = obj.length;
+    obj.clear();
+
+    return *this;
+}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * Copies every value into this list's own pool, like the copy constructor.
+ *
+ * @param obj The list to copy.
+ * @return A reference to this list.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator> &compact_linked_list<A, Allocator>::operator=(const compact_linked_list<A, Allocator> &obj)
+{
+    if (this == &obj)
+        return *this;
+
+    this->clear();
+    this->reserve(obj.length);
+    for (const A &value: obj)
+        this->append(value);
+
+    return *this;
+}
+
+/**
+ * @brief Returns the slot at a position of the list.
+ *
+ * @param index The position, negative positions count from the end. Must be in range.
+ * @return The index of the slot.
+ */
+template <typename A, typename Allocator>
+uint32_t compact_linked_list<A, Allocator>::getslot(const int64_t &index) const
+{
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+
+    uint32_t ptr = this->head;
+    for (int64_t i = 0; i < position; i++)
+        ptr = this->links[ptr];
+    LINKEDLIST_STAT_HOPS(position);
+
+    return ptr;
+}
+
+/**
+ * @brief Takes a slot off the free list, or from the end of the pool, and stores a value in it.
+ *
+ * The slot is not linked into the list yet, but counts towards its length.
+ *
+ * @param value The value to store.
+ * @return The index of the slot.
+ * @throws INDEX_ERROR If every 32-bit slot index is in use.
+ */
+template <typename A, typename Allocator>
+uint32_t compact_linked_list<A, Allocator>::acquire(const A &value)
+{
+    uint32_t index = this->unused;
+    if (index != nil)
+    {
+        this->unused = this->links[index];
+        this->values[index] = value;
+        this->links[index] = nil;
+    }
+
+    else
+    {
+        if (this->values.size() >= (size_t)nil)
+            throw INDEX_ERROR("List Capacity Exceeded");
+
+        index = (uint32_t)this->values.size();
+        this->values.push_back(value);
+        try
+        {
+            this->links.push_back(nil);
+        }
+        catch (...)
+        {
+            this->values.pop_back();
+            throw;
+        }
+    }
+    LINKEDLIST_STAT_ALLOC();
+
+    this->length++;
+    return index;
+}
+
+/**
+ * @brief Unlinks a slot from the list and returns it to the free list.
+ *
+ * @param prev The slot before `index`, nil if `index` is the head.
+ * @param index The slot to unlink.
+ * @return The value that was stored in the slot.
+ */
+template <typename A, typename Allocator>
+A compact_linked_list<A, Allocator>::unlink(uint32_t prev, uint32_t index)
+{
+    if (prev == nil)
+        this->head = this->links[index];
+    else
+        this->links[prev] = this->links[index];
+
+    if (this->tail == index)
+        this->tail = prev;
+
+    this->links[index] = this->unused;
+    this->unused = index;
+    LINKEDLIST_STAT_FREE();
+
+    this->length--;
+    return std::move(this->values[index]);
+}
+
+/**
+ * @brief Replaces the pool with values already in list order.
+ *
+ * Slot `i` then holds the `i`th value and links to slot `i + 1`, and no slot is spare.
+ *
+ * @param ordered The values of the list, in order.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::relayout(std::vector<A, Allocator> &&ordered)
+{
+    std::vector<uint32_t, link_allocator> relinked(this->links.get_allocator());
+    relinked.reserve(ordered.size());
+    for (size_t i = 1; i <= ordered.size(); i++)
+        relinked.push_back((i == ordered.size()) ? nil : (uint32_t)i);
+
+    this->values = std::move(ordered);
+    this->links = std::move(relinked);
+
+    this->length = this->values.size();
+    this->head = this->isempty() ? nil : 0;
+    this->tail = this->isempty() ? nil : (uint32_t)(this->length - 1);
+    this->unused = nil;
+}
+
+/**
+ * @brief Prepend a value to the list.
+ * @param value The value to prepend.
+ * @throws INDEX_ERROR If the list already holds the most values a 32-bit index can address.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::prepend(const A &value)
+{
+    uint32_t index = this->acquire(value);
+    this->links[index] = this->head;
+
+    if (this->tail == nil)
+        this->tail = index;
+
+    this->head = index;
+}
+
+/**
+ * @brief Append a value to the list.
+ * @param value The value to append.
+ * @throws INDEX_ERROR If the list already holds the most values a 32-bit index can address.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::append(const A &value)
+{
+    uint32_t index = this->acquire(value);
+
+    if (this->head == nil)
+        this->head = index;
+    else
+        this->links[this->tail] = index;
+
+    this->tail = index;
+}
+
+/**
+ * @brief Insert a value before a position of the list.
+ *
+ * Negative positions count from the end; positions past either end insert at that end.
+ *
+ * @param index The position to insert at.
+ * @param value The value to insert.
+ * @throws INDEX_ERROR If the list already holds the most values a 32-bit index can address.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::insert(const int64_t &index, const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert);
+
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+
+    if (position <= 0L)
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (position >= (int64_t)this->length)
+    {
+        this->append(value);
+        return;
+    }
+
+    uint32_t prev = this->getslot(position - 1L);
+    uint32_t slot = this->acquire(value);
+
+    this->links[slot] = this->links[prev];
+    this->links[prev] = slot;
+}
+
+/**
+ * @brief Insert a value keeping an ascending list sorted.
+ * @param value The value to insert.
+ * @throws INDEX_ERROR If the list already holds the most values a 32-bit index can address.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::insert_in_order(const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert_in_order);
+
+    if (this->isempty() || this->values[this->head] >= value)
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (this->values[this->tail] <= value)
+    {
+        this->append(value);
+        return;
+    }
+
+    uint32_t ptr = this->head;
+    while (this->links[ptr] != nil && this->values[this->links[ptr]] < value)
+        ptr = this->links[ptr];
+
+    uint32_t slot = this->acquire(value);
+    this->links[slot] = this->links[ptr];
+    this->links[ptr] = slot;
+}
+
+/**
+ * @brief Extends the list with values from an initializer list.
+ * @param values The values to append.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::extend(const std::initializer_list<A> &values)
+{
+    this->append_range(values.begin(), values.end());
+}
+
+/**
+ * @brief Extends the list with values from an array.
+ * @param array The values to append.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+void compact_linked_list<A, Allocator>::extend(const A (&array)[N])
+{
+    this->append_range(array, array + N);
+}
+
+/**
+ * @brief Extends the list with values from a vector.
+ * @param values The values to append.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::extend(const std::vector<A> &values)
+{
+    this->append_range(values.begin(), values.end());
+}
+
+/**
+ * @brief Removes the first occurrence of a value.
+ * @param value The value to remove.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::remove(const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    if (this->isempty())
+        throw VALUE_ERROR("Removing from Empty List");
+
+    uint32_t prev = nil, ptr = this->head;
+    while (ptr != nil && !(this->values[ptr] == value))
+    {
+        prev = ptr;
+        ptr = this->links[ptr];
+    }
+
+    if (ptr == nil)
+        throw VALUE_ERROR("Removing `x`, non-element in the List");
+
+    this->unlink(prev, ptr);
+}
+
+/**
+ * @brief Removes and returns the value at a position.
+ * @param index The position, negative positions count from the end.
+ * @return The removed value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator>
+A compact_linked_list<A, Allocator>::pop(const int64_t &index)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    if (this->isempty())
+        throw INDEX_ERROR("Pop from Empty List");
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR("Pop index out of range");
+
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+    if (position == 0L)
+        return this->unlink(nil, this->head);
+
+    uint32_t prev = this->getslot(position - 1L);
+    return this->unlink(prev, this->links[prev]);
+}
+
+/**
+ * @brief Removes and returns the last value.
+ * @return The removed value.
+ * @throws INDEX_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+A compact_linked_list<A, Allocator>::pop()
+{
+    return this->pop(-1L);
+}
+
+/**
+ * @brief Returns the number of values in the list.
+ * @return The number of values.
+ */
+template <typename A, typename Allocator>
+size_t compact_linked_list<A, Allocator>::size() const
+{
+    return this->length;
+}
+
+/**
+ * @brief Checks if the list is empty.
+ * @return true if the list holds no values, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::isempty() const
+{
+    return this->head == nil;
+}
+
+/**
+ * @brief Checks if the list contains a value.
+ * @param value The value to search for.
+ * @return true if the value is found, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::contains(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::contains);
+
+    for (uint32_t ptr = this->head; ptr != nil; ptr = this->links[ptr])
+        if (this->values[ptr] == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Returns the position of the first occurrence of a value.
+ * @param value The value to search for.
+ * @return The position of the value.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A, typename Allocator>
+int64_t compact_linked_list<A, Allocator>::index(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::index);
+
+    if (this->isempty())
+        throw VALUE_ERROR("Index of Element from Empty List");
+
+    int64_t curr_index = 0L;
+    for (uint32_t ptr = this->head; ptr != nil; ptr = this->links[ptr])
+    {
+        if (this->values[ptr] == value)
+            return curr_index;
+        curr_index++;
+    }
+
+    throw VALUE_ERROR("Value `x` not in List");
+}
+
+/**
+ * @brief Counts the occurrences of a value.
+ * @param value The value to count.
+ * @return The number of occurrences.
+ */
+template <typename A, typename Allocator>
+size_t compact_linked_list<A, Allocator>::count(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::count);
+
+    size_t founds = 0;
+    for (uint32_t ptr = this->head; ptr != nil; ptr = this->links[ptr])
+        if (this->values[ptr] == value)
+            founds++;
+
+    return founds;
+}
+
+/**
+ * @brief Reverses the order of the values in place.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::reverse()
+{
+    uint32_t current = this->head, prev = nil;
+    this->tail = this->head;
+    while (current != nil)
+    {
+        uint32_t next_slot = this->links[current];
+        this->links[current] = prev;
+        prev = current;
+        current = next_slot;
+    }
+
+    this->head = prev;
+}
+
+/**
+ * @brief Sorts the list in ascending order.
+ *
+ * The values are moved out in list order, stably sorted as an array and laid
+ * back out in order. This also does the work of compact().
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::sort()
+{
+    if (this->length < 2)
+        return;
+
+    std::vector<A, Allocator> ordered(this->values.get_allocator());
+    ordered.reserve(this->length);
+    for (uint32_t ptr = this->head; ptr != nil; ptr = this->links[ptr])
+        ordered.push_back(std::move(this->values[ptr]));
+
+    std::stable_sort(ordered.begin(), ordered.end(), [](const A &left, const A &right) { return left < right; });
+    this->relayout(std::move(ordered));
+}
+
+/**
+ * @brief Reserves pool space for a number of values.
+ *
+ * @param capacity The number of values the pool should hold without growing.
+ * @throws INDEX_ERROR If `capacity` exceeds what a 32-bit index can address.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::reserve(const size_t &capacity)
+{
+    if (capacity > (size_t)nil)
+        throw INDEX_ERROR("List Capacity Exceeded");
+
+    this->values.reserve(capacity);
+    this->links.reserve(capacity);
+}
+
+/**
+ * @brief Returns the number of values the pool holds without growing.
+ * @return The capacity of the pool.
+ */
+template <typename A, typename Allocator>
+size_t compact_linked_list<A, Allocator>::capacity() const
+{
+    return std::min(this->values.capacity(), this->links.capacity());
+}
+
+/**
+ * @brief Lays the list out in order and frees the spare slots.
+ *
+ * Afterwards slot `i` holds the `i`th value, so a traversal reads the pool
+ * front to back. Iterators are invalidated.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::compact()
+{
+    std::vector<A, Allocator> ordered(this->values.get_allocator());
+    ordered.reserve(this->length);
+    for (uint32_t ptr = this->head; ptr != nil; ptr = this->links[ptr])
+        ordered.push_back(std::move(this->values[ptr]));
+
+    this->relayout(std::move(ordered));
+}
+
+/**
+ * @brief Reports the bytes held by the list.
+ *
+ * Spare pool capacity, including slots on the free list, counts as reserved.
+ *
+ * @return The bytes used by values, links, spare pool capacity and the list object.
+ */
+template <typename A, typename Allocator>
+list_memory compact_linked_list<A, Allocator>::memory_usage() const
+{
+    list_memory usage = list_memory();
+    usage.payload = this->length * sizeof(A);
+    usage.links = this->length * sizeof(uint32_t);
+    usage.reserved = (this->values.capacity() - this->length) * sizeof(A) + (this->links.capacity() - this->length) * sizeof(uint32_t);
+    usage.control = sizeof(*this);
+
+    return usage;
+}
+
+/**
+ * @brief Accesses the value at a position.
+ * @param index The position, negative positions count from the end.
+ * @return A reference to the value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator>
+A &compact_linked_list<A, Allocator>::operator[](const int64_t &index)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
+
+    if (this->isempty())
+        throw INDEX_ERROR("Indexing an Empty List");
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR("List index out of range");
+
+    return this->values[this->getslot(index)];
+}
+
+/**
+ * @brief Accesses the value at a position of a const list.
+ * @param index The position, negative positions count from the end.
+ * @return A const reference to the value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator>
+const A &compact_linked_list<A, Allocator>::operator[](const int64_t &index) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
+
+    if (this->isempty())
+        throw INDEX_ERROR("Indexing an Empty List");
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR("List index out of range");
+
+    return this->values[this->getslot(index)];
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::operator>(const compact_linked_list<A, Allocator> &obj) const
+{
+    return obj < *this;
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than another.
+ * @param obj The list to compare with.
+ * @return true if this list is less, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::operator<(const compact_linked_list<A, Allocator> &obj) const
+{
+    uint32_t left = this->head, right = obj.head;
+    while (left != nil && right != nil)
+    {
+        if (this->values[left] < obj.values[right])
+            return true;
+        if (obj.values[right] < this->values[left])
+            return false;
+        left = this->links[left];
+        right = obj.links[right];
+    }
+
+    return left == nil && right != nil;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater or equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::operator>=(const compact_linked_list<A, Allocator> &obj) const
+{
+    return !(*this < obj);
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is less or equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::operator<=(const compact_linked_list<A, Allocator> &obj) const
+{
+    return !(obj < *this);
+}
+
+/**
+ * @brief Checks if two lists hold the same values in the same order.
+ * @param obj The list to compare with.
+ * @return true if the lists are equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::operator==(const compact_linked_list<A, Allocator> &obj) const
+{
+    if (this->length != obj.length)
+        return false;
+
+    uint32_t left = this->head, right = obj.head;
+    while (left != nil)
+    {
+        if (!(this->values[left] == obj.values[right]))
+            return false;
+        left = this->links[left];
+        right = obj.links[right];
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks if two lists differ.
+ * @param obj The list to compare with.
+ * @return true if the lists are not equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool compact_linked_list<A, Allocator>::operator!=(const compact_linked_list<A, Allocator> &obj) const
+{
+    return !(*this == obj);
+}
+
+/**
+ * @brief Converts the list to a vector.
+ * @return A vector holding the values in order.
+ */
+template <typename A, typename Allocator>
+compact_linked_list<A, Allocator>::operator std::vector<A>() const
+{
+    std::vector<A> values;
+    values.reserve(this->length);
+    for (uint32_t ptr = this->head; ptr != nil; ptr = this->links[ptr])
+        values.push_back(this->values[ptr]);
+
+    return values;
+}
+
+/**
+ * @brief Converts the list to a string.
+ * @return The list formatted as by `operator<<`.
+ */
+template <typename A, typename Allocator>
+std::string compact_linked_list<A, Allocator>::to_string() const
+{
+    std::ostringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+/**
+ * @brief Prints the list to the standard output.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::show() const
+{
+    std::cout << *this;
+}
+
+/**
+ * @brief Removes every value and releases the pool.
+ */
+template <typename A, typename Allocator>
+void compact_linked_list<A, Allocator>::clear()
+{
+    std::vector<A, Allocator>(this->values.get_allocator()).swap(this->values);
+    std::vector<uint32_t, link_allocator>(this->links.get_allocator()).swap(this->links);
+
+    this->head = this->tail = this->unused = nil;
+    this->length = 0;
+}
+
+/**
+ * @brief Returns the allocator the pool is obtained from.
+ * @return A copy of the allocator.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::allocator_type compact_linked_list<A, Allocator>::get_allocator() const
+{
+    return this->values.get_allocator();
+}
+
+/**
+ * @brief Get an iterator to the first value.
+ * @return An iterator to the head of the list.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::iterator compact_linked_list<A, Allocator>::begin()
+{
+    return iterator(this, this->head);
+}
+
+/**
+ * @brief Get an iterator past the last value.
+ * @return An iterator to the end of the list.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::iterator compact_linked_list<A, Allocator>::end()
+{
+    return iterator(this, nil);
+}
+
+/**
+ * @brief Get a const_iterator to the first value of a const list.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::const_iterator compact_linked_list<A, Allocator>::begin() const
+{
+    return const_iterator(this, this->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value of a const list.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::const_iterator compact_linked_list<A, Allocator>::end() const
+{
+    return const_iterator(this, nil);
+}
+
+/**
+ * @brief Get a const_iterator to the first value.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::const_iterator compact_linked_list<A, Allocator>::cbegin() const
+{
+    return const_iterator(this, this->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A, typename Allocator>
+typename compact_linked_list<A, Allocator>::const_iterator compact_linked_list<A, Allocator>::cend() const
+{
+    return const_iterator(this, nil);
+}
+
+/**
+ * @brief Finds the minimum value of a compact linked list.
+ * @param obj The list to search.
+ * @return The minimum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+A min(const compact_linked_list<A, Allocator> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding min in Empty List");
+
+    A min_value = obj.values[obj.head];
+    for (uint32_t ptr = obj.links[obj.head]; ptr != compact_linked_list<A, Allocator>::nil; ptr = obj.links[ptr])
+        if (obj.values[ptr] < min_value)
+            min_value = obj.values[ptr];
+
+    return min_value;
+}
+
+/**
+ * @brief Finds the maximum value of a compact linked list.
+ * @param obj The list to search.
+ * @return The maximum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+A max(const compact_linked_list<A, Allocator> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding max in Empty List");
+
+    A max_value = obj.values[obj.head];
+    for (uint32_t ptr = obj.links[obj.head]; ptr != compact_linked_list<A, Allocator>::nil; ptr = obj.links[ptr])
+        if (obj.values[ptr] > max_value)
+            max_value = obj.values[ptr];
+
+    return max_value;
+}
+
+/**
+ * @brief Returns the number of values in a compact linked list.
+ * @param obj The list.
+ * @return The number of values.
+ */
+template <typename A, typename Allocator>
+size_t len(const compact_linked_list<A, Allocator> &obj)
+{
+    return obj.size();
+}
+
+/**
+ * @brief Outputs the compact linked list to an output stream.
+ * @param out The output stream to which the list will be written.
+ * @param obj The list to be printed.
+ * @return The output stream with the list data.
+ */
+template <typename A, typename Allocator>
+std::ostream &operator<<(std::ostream &out, const compact_linked_list<A, Allocator> &obj)
+{
+    out << "[";
+
+    for (uint32_t ptr = obj.head; ptr != compact_linked_list<A, Allocator>::nil; ptr = obj.links[ptr])
+    {
+        out << obj.values[ptr];
+        if (obj.links[ptr] != compact_linked_list<A, Allocator>::nil)
+            out << ", ";
+    }
+
+    out << "]";
+
+    return out;
+}
@@ -0,0 +1,56 @@
+#include <iostream>
+
+#include "singly_linked_list.hpp"
+#include "compact_linked_list.hpp"
+
+/**
+ * @file compact_linked_list_example.cpp
+ * @brief Demonstrates the memory saved by a compact linked list.
+ *
+ * This program builds the same list of integers as a singly linked list and as
+ * a compact linked list, and prints what `memory_usage()` reports for each.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+void report(const char *name, const list_memory &usage, const size_t &values)
+{
+    std::cout << name << ": " << usage.total() << " bytes, "
+              << (double)usage.total() / values << " per value "
+              << "(payload " << usage.payload << ", links " << usage.links
+              << ", padding " << usage.padding << ", reserved " << usage.reserved
+              << ", control " << usage.control << ")" << std::endl;
+}
+
+int main()
+{
+    const size_t values = 100000;
+
+    singly_linked_list<int> nodes;
+    for (size_t i = 0; i < values; i++)
+        nodes.append((int)i);
+
+    compact_linked_list<int> pool(nodes);
+
+    report("singly_linked_list", nodes.memory_usage(), values);
+    report("compact_linked_list", pool.memory_usage(), values);
+
+    // Removed slots are reused by later insertions
+    for (int i = 0; i < 1000; i++)
+        pool.pop(0);
+    for (int i = 0; i < 1000; i++)
+        pool.prepend(-i);
+    std::cout << "capacity after reuse: " << pool.capacity() << std::endl; // capacity after reuse: 100000
+
+    // compact() lays the list out in order and frees the spare slots
+    for (int i = 0; i < 50000; i++)
+        pool.pop();
+    pool.compact();
+    report("after compact()", pool.memory_usage(), pool.size());
+
+    std::cout << "front: " << pool[0] << ", back: " << pool[-1] << std::endl; // front: -999, back: 49999
+
+    return 0;
+}
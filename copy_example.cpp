@@ -0,0 +1,44 @@
+#include <iostream>
+
+#include "singly_linked_list.hpp"
+
+/**
+ * @file copy_example.cpp
+ * @brief Demonstrates copying a singly linked list.
+ *
+ * This program shows that copies of a list share its nodes, so a value written
+ * through one is seen through the other, and that a list keeping values in
+ * inline slots is copied value by value instead, leaving it and its iterators
+ * untouched.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    // Copies share their nodes
+    singly_linked_list<int> list1 = {1, 2, 3};
+    singly_linked_list<int> list2 = list1;
+    list2[0] = 10;
+    std::cout << "list1: " << list1 << std::endl; // list1: [10, 2, 3]
+    std::cout << "list2: " << list2 << std::endl; // list2: [10, 2, 3]
+
+    // A list with inline slots keeps its nodes where they are when copied
+    singly_linked_list<int, std::allocator<int>, 4> small = {1, 2, 3};
+    singly_linked_list<int, std::allocator<int>, 4>::iterator second = std::next(small.begin());
+    int &first = small[0];
+
+    singly_linked_list<int, std::allocator<int>, 4> copy = small;
+    first = 7;
+    *second = 8;
+    std::cout << "small: " << small << std::endl; // small: [7, 8, 3]
+    std::cout << "copy: " << copy << std::endl; // copy: [1, 2, 3]
+
+    copy = small;
+    std::cout << "copy: " << copy << std::endl; // copy: [7, 8, 3]
+    std::cout << "*second: " << *second << std::endl; // *second: 8
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+#if __cplusplus >= 201103L
+
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#include <array>
+#include <utility>
+
+#include "./linkedlist.hpp"
+
+template <typename A, typename Allocator = std::allocator<A>>
+class doubly_linked_list final: public linkedlist<A, Allocator>, public static_list<doubly_linked_list<A, Allocator>>
+{
+    private:
+        typedef struct dnode: linkedlist<A, Allocator>::node
+        {
+            struct dnode *prev;
+        } dnode;
+
+        static dnode *cast(typename linkedlist<A, Allocator>::node *ptr);
+        static bool precedes(typename linkedlist<A, Allocator>::node *left, typename linkedlist<A, Allocator>::node *right);
+
+        dnode *getnode(const int64_t &index) const;
+        void link_after(dnode *ptr, dnode *new_node);
+        A unlink(dnode *ptr);
+
+        doubly_linked_list<A, Allocator> detach(size_t begin, size_t end);
+        size_t detach(size_t begin, size_t end, std::vector<A> &values);
+    public:
+        class reverse_iterator
+        {
+            private:
+                dnode *ptr;
+
+                reverse_iterator(dnode *ptr);
+
+                friend class doubly_linked_list<A, Allocator>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef A *pointer;
+                typedef A &reference;
+
+                reverse_iterator();
+
+                reverse_iterator &operator++();
+                reverse_iterator operator++(int);
+                A &operator*() const;
+                A *operator->() const;
+                bool operator==(const reverse_iterator &it) const;
+                bool operator!=(const reverse_iterator &it) const;
+
+                ~reverse_iterator() = default;
+        };
+
+        class const_reverse_iterator
+        {
+            private:
+                const dnode *ptr;
+
+                const_reverse_iterator(const dnode *ptr);
+
+                friend class doubly_linked_list<A, Allocator>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const A *pointer;
+                typedef const A &reference;
+
+                const_reverse_iterator();
+
+                const_reverse_iterator &operator++();
+                const_reverse_iterator operator++(int);
+                const A &operator*() const;
+                const A *operator->() const;
+                bool operator==(const const_reverse_iterator &it) const;
+                bool operator!=(const const_reverse_iterator &it) const;
+
+                ~const_reverse_iterator() = default;
+        };
+
+        doubly_linked_list();
+        explicit doubly_linked_list(const Allocator &alloc);
+
+        doubly_linked_list(doubly_linked_list<A, Allocator> &&obj);
+        doubly_linked_list(const doubly_linked_list<A, Allocator> &obj);
+        doubly_linked_list(const std::initializer_list<A> &values, const Allocator &alloc = Allocator());
+
+        template <size_t N>
+        doubly_linked_list(const A (&array)[N], const Allocator &alloc = Allocator());
+        doubly_linked_list(const std::vector<A> &values, const Allocator &alloc = Allocator());
+
+        doubly_linked_list<A, Allocator> &operator=(doubly_linked_list<A, Allocator> &&obj);
+        doubly_linked_list<A, Allocator> &operator=(const doubly_linked_list<A, Allocator> &obj);
+        doubly_linked_list<A, Allocator> &operator=(const std::initializer_list<A> &values);
+
+        template <size_t N>
+        doubly_linked_list<A, Allocator> &operator=(const A (&array)[N]);
+        doubly_linked_list<A, Allocator> &operator=(const std::vector<A> &values);
+
+        void prepend(const A &value) override;
+        void append(const A &value) override;
+        void insert(const int64_t &index, const A &value) override;
+        void insert(const int64_t &index, const linkedlist<A, Allocator> &obj) override;
+        void insert(const int64_t &index, const std::initializer_list<A> &values) override;
+
+        template <size_t N>
+        void insert(const int64_t &index, const A (&array)[N]);
+        void insert(const int64_t &index, const std::vector<A> &values) override;
+
+        void insert_in_order(const A &value) override;
+
+        template <typename Compare>
+        void insert_in_order(const A &value, Compare comp);
+        void insert_in_order(const linkedlist<A, Allocator> &obj) override;
+        void insert_in_order(const std::initializer_list<A> &values) override;
+
+        template <size_t N>
+        void insert_in_order(const A (&array)[N]);
+        void insert_in_order(const std::vector<A> &values) override;
+
+        void extend(const linkedlist<A, Allocator> &obj) override;
+        void extend(const std::initializer_list<A> &values) override;
+
+        template <size_t N>
+        void extend(const A (&array)[N]);
+        void extend(const std::vector<A> &values) override;
+
+        void remove(const A &value) override;
+        A pop(const int64_t &index) override;
+        A pop() override;
+        size_t remove_all(const A &value) override;
+        size_t erase(const int64_t &first, const int64_t &last) override;
+
+        bool try_pop(const int64_t &index, A &value) override;
+        bool try_pop(A &value) override;
+        bool try_remove(const A &value) override;
+
+        typename linkedlist<A, Allocator>::iterator insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const A &value);
+        typename linkedlist<A, Allocator>::iterator insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const std::initializer_list<A> &values);
+
+        template <typename InputIt>
+        typename linkedlist<A, Allocator>::iterator insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, InputIt first, InputIt last);
+        typename linkedlist<A, Allocator>::iterator erase_after(const typename linkedlist<A, Allocator>::const_iterator &pos);
+        typename linkedlist<A, Allocator>::iterator erase_after(const typename linkedlist<A, Allocator>::const_iterator &first, const typename linkedlist<A, Allocator>::const_iterator &last);
+
+        template <typename Predicate>
+        size_t remove_if(Predicate pred);
+
+        doubly_linked_list<A, Allocator> pop_front_n(const size_t &count);
+        size_t pop_front_n(const size_t &count, std::vector<A> &values);
+        doubly_linked_list<A, Allocator> pop_back_n(const size_t &count);
+        size_t pop_back_n(const size_t &count, std::vector<A> &values);
+        doubly_linked_list<A, Allocator> pop_range(const int64_t &index, const size_t &count);
+        size_t pop_range(const int64_t &index, const size_t &count, std::vector<A> &values);
+        doubly_linked_list<A, Allocator> truncate(const size_t &new_size);
+        size_t truncate(const size_t &new_size, std::vector<A> &values);
+
+        bool contains(const A &value) const override;
+        int64_t index(const A &value) const override;
+        size_t count(const A &value) const override;
+        bool try_index(const A &value, size_t &index) const override;
+
+        void reverse() override;
+        void sort() override;
+
+        template <typename Compare>
+        void sort(Compare comp);
+        template <typename KeyFn>
+        void sort_by_key(KeyFn key);
+
+        doubly_linked_list<A, Allocator> copy() const;
+
+        A &operator[](const int64_t &index) override;
+        A *try_at(const int64_t &index) override;
+        doubly_linked_list<A, Allocator> operator+(const linkedlist<A, Allocator> &obj) const;
+        doubly_linked_list<A, Allocator> operator*(const size_t &times);
+
+        bool operator>(const linkedlist<A, Allocator> &obj) const override;
+        bool operator<(const linkedlist<A, Allocator> &obj) const override;
+        bool operator>=(const linkedlist<A, Allocator> &obj) const override;
+        bool operator<=(const linkedlist<A, Allocator> &obj) const override;
+        bool operator==(const linkedlist<A, Allocator> &obj) const override;
+        bool operator!=(const linkedlist<A, Allocator> &obj) const override;
+
+        template <size_t N>
+        operator std::array<A, N>();
+        operator A *() override;
+        operator std::vector<A>() override;
+
+        std::string to_string() override;
+        void show() override;
+
+        void clear() override;
+
+        list_memory memory_usage() const override;
+
+        reverse_iterator rbegin();
+        reverse_iterator rend();
+        const_reverse_iterator crbegin() const;
+        const_reverse_iterator crend() const;
+
+        template <typename B, typename C>
+        friend std::ostream &operator<<(std::ostream &out, doubly_linked_list<B, C> &obj);
+
+        ~doubly_linked_list();
+};
+
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> operator*(const size_t &times, doubly_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+std::ostream &operator<<(std::ostream &out, doubly_linked_list<A, Allocator> &obj);
+
+#if __cplusplus >= 201703L && defined(__has_include)
+    #if __has_include(<memory_resource>)
+        namespace pmr
+        {
+            template <typename A>
+            using doubly_linked_list = ::doubly_linked_list<A, std::pmr::polymorphic_allocator<A>>;
+        }
+    #endif
+#endif
+
+#include "./doubly_linked_list.tpp"
+
+#endif
+
+#else
+    #error "Requires C++11 or later.\n"
+
+#endif
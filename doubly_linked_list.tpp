@@ -0,0 +1,1996 @@
+#include "./doubly_linked_list.hpp"
+
+
+/**
+ * @brief Default constructor for the reverse_iterator.
+ *
+ * Initializes the reverse_iterator with the pointer to nullptr.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::reverse_iterator::reverse_iterator():
+    ptr(nullptr) {}
+
+/**
+ * @brief Constructor for the reverse_iterator.
+ *
+ * Initializes the reverse_iterator with the pointer to a node in the linked list.
+ *
+ * @param ptr A pointer to the node the reverse_iterator will point to.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::reverse_iterator::reverse_iterator(typename doubly_linked_list<A, Allocator>::dnode *ptr):
+    ptr(ptr) {}
+
+/**
+ * @brief Prefix increment operator for the reverse_iterator.
+ *
+ * Moves the reverse_iterator to the previous element in the linked list.
+ *
+ * @return doubly_linked_list<A, Allocator>::reverse_iterator& A reference to the updated reverse_iterator.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::reverse_iterator &doubly_linked_list<A, Allocator>::reverse_iterator::operator++()
+{
+    this->ptr = this->ptr->prev;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the reverse_iterator.
+ *
+ * Moves the reverse_iterator to the previous element in the linked list.
+ *
+ * @param int Dummy parameter to distinguish from the prefix increment.
+ * @return doubly_linked_list<A, Allocator>::reverse_iterator A copy of the reverse_iterator before incrementing.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::reverse_iterator doubly_linked_list<A, Allocator>::reverse_iterator::operator++(int)
+{
+    reverse_iterator it = *this;
+    this->ptr = this->ptr->prev;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the reverse_iterator.
+ *
+ * @return A& A reference to the value the reverse_iterator points to.
+ */
+template <typename A, typename Allocator>
+A &doubly_linked_list<A, Allocator>::reverse_iterator::operator*() const
+{
+    return this->ptr->value;
+}
+
+/**
+ * @brief Member access operator for the reverse_iterator.
+ *
+ * @return A* A pointer to the value the reverse_iterator points to.
+ */
+template <typename A, typename Allocator>
+A *doubly_linked_list<A, Allocator>::reverse_iterator::operator->() const
+{
+    return &this->ptr->value;
+}
+
+/**
+ * @brief Equality operator for the reverse_iterator.
+ *
+ * @param it The reverse_iterator to compare against.
+ * @return true If both reverse_iterators point to the same node, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::reverse_iterator::operator==(const typename doubly_linked_list<A, Allocator>::reverse_iterator &it) const
+{
+    return this->ptr == it.ptr;
+}
+
+/**
+ * @brief Inequality operator for the reverse_iterator.
+ *
+ * @param it The reverse_iterator to compare against.
+ * @return true If both reverse_iterators point to different nodes, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::reverse_iterator::operator!=(const typename doubly_linked_list<A, Allocator>::reverse_iterator &it) const
+{
+    return this->ptr != it.ptr;
+}
+
+/**
+ * @brief Default constructor for the const_reverse_iterator.
+ *
+ * Initializes the const_reverse_iterator with the pointer to nullptr.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::const_reverse_iterator::const_reverse_iterator():
+    ptr(nullptr) {}
+
+/**
+ * @brief Constructor for the const_reverse_iterator.
+ *
+ * Initializes the const_reverse_iterator with the pointer to a node in the linked list.
+ *
+ * @param ptr A pointer to the node the const_reverse_iterator will point to.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::const_reverse_iterator::const_reverse_iterator(const typename doubly_linked_list<A, Allocator>::dnode *ptr):
+    ptr(ptr) {}
+
+/**
+ * @brief Prefix increment operator for the const_reverse_iterator.
+ *
+ * Moves the const_reverse_iterator to the previous element in the linked list.
+ *
+ * @return doubly_linked_list<A, Allocator>::const_reverse_iterator& A reference to the updated const_reverse_iterator.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::const_reverse_iterator &doubly_linked_list<A, Allocator>::const_reverse_iterator::operator++()
+{
+    this->ptr = this->ptr->prev;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the const_reverse_iterator.
+ *
+ * Moves the const_reverse_iterator to the previous element in the linked list.
+ *
+ * @param int Dummy parameter to distinguish from the prefix increment.
+ * @return doubly_linked_list<A, Allocator>::const_reverse_iterator A copy of the const_reverse_iterator before incrementing.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::const_reverse_iterator doubly_linked_list<A, Allocator>::const_reverse_iterator::operator++(int)
+{
+    const_reverse_iterator it = *this;
+    this->ptr = this->ptr->prev;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the const_reverse_iterator.
+ *
+ * @return const A& A const reference to the value the const_reverse_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A &doubly_linked_list<A, Allocator>::const_reverse_iterator::operator*() const
+{
+    return this->ptr->value;
+}
+
+/**
+ * @brief Member access operator for the const_reverse_iterator.
+ *
+ * @return const A* A const pointer to the value the const_reverse_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A *doubly_linked_list<A, Allocator>::const_reverse_iterator::operator->() const
+{
+    return &this->ptr->value;
+}
+
+/**
+ * @brief Equality operator for the const_reverse_iterator.
+ *
+ * @param it The const_reverse_iterator to compare against.
+ * @return true If both const_reverse_iterators point to the same node, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::const_reverse_iterator::operator==(const typename doubly_linked_list<A, Allocator>::const_reverse_iterator &it) const
+{
+    return this->ptr == it.ptr;
+}
+
+/**
+ * @brief Inequality operator for the const_reverse_iterator.
+ *
+ * @param it The const_reverse_iterator to compare against.
+ * @return true If both const_reverse_iterators point to different nodes, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::const_reverse_iterator::operator!=(const typename doubly_linked_list<A, Allocator>::const_reverse_iterator &it) const
+{
+    return this->ptr != it.ptr;
+}
+
+/**
+ * @brief Default constructor for doubly_linked_list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::doubly_linked_list(): doubly_linked_list<A, Allocator>(Allocator()) {}
+
+/**
+ * @brief Constructs an empty doubly linked list using the given allocator.
+ *
+ * No memory is allocated until the first value is added.
+ *
+ * @param alloc The allocator to be used by the list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::doubly_linked_list(const Allocator &alloc): linkedlist<A, Allocator>::linkedlist(alloc) {}
+
+/**
+ * @brief Move constructor for doubly_linked_list.
+ *
+ * Takes over the nodes and the allocator of `obj`, which is left as a valid
+ * empty list.
+ *
+ * @param obj The doubly_linked_list object to move from.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::doubly_linked_list(doubly_linked_list<A, Allocator> &&obj): linkedlist<A, Allocator>::linkedlist(obj.alloc)
+{
+    this->take(obj);
+}
+
+/**
+ * @brief Constructs a doubly linked list sharing the nodes of another.
+ *
+ * Like `singly_linked_list`, the copy refers to the same nodes as `obj` and the
+ * reference count is incremented. Use `copy()` for an independent list.
+ *
+ * @param obj The `doubly_linked_list` object to share from.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::doubly_linked_list(const doubly_linked_list<A, Allocator> &obj): linkedlist<A, Allocator>::linkedlist(obj.alloc)
+{
+    this->share(obj);
+}
+
+/**
+ * @brief Constructor from an initializer list.
+ * @param values Initializer list of values to initialize the list with.
+ * @param alloc The allocator to be used by the list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::doubly_linked_list(const std::initializer_list<A> &values, const Allocator &alloc):
+    doubly_linked_list<A, Allocator>(alloc)
+{
+    this->extend(values);
+}
+
+/**
+ * @brief Constructor from an array.
+ * @param array Array of values to initialize the list with.
+ * @param alloc The allocator to be used by the list.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+doubly_linked_list<A, Allocator>::doubly_linked_list(const A (&array)[N], const Allocator &alloc):
+    doubly_linked_list<A, Allocator>(alloc)
+{
+    this->extend(array);
+}
+
+/**
+ * @brief Constructor from a vector.
+ * @param values Vector of values to initialize the list with.
+ * @param alloc The allocator to be used by the list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::doubly_linked_list(const std::vector<A> &values, const Allocator &alloc):
+    doubly_linked_list<A, Allocator>(alloc)
+{
+    this->extend(values);
+}
+
+/**
+ * @brief Move assignment operator for doubly_linked_list.
+ *
+ * Releases the current contents and takes over the nodes of `obj`, which is left
+ * empty, together with its allocator when it propagates on move assignment.
+ * Unequal allocators that do not propagate cannot take over each other's nodes,
+ * so the values of `obj` are copied instead.
+ *
+ * @param obj The doubly_linked_list object to move from.
+ * @return A reference to this doubly_linked_list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> &doubly_linked_list<A, Allocator>::operator=(doubly_linked_list<A, Allocator> &&obj)
+{
+    typedef typename std::allocator_traits<Allocator>::propagate_on_container_move_assignment propagate;
+
+    if (this == &obj)
+        return *this;
+
+    this->release();
+
+    if (!propagate::value && this->alloc != obj.alloc)
+    {
+        this->reset();
+        this->extend(obj);
+
+        return *this;
+    }
+
+    linkedlist<A, Allocator>::propagate_move(this->alloc, obj.alloc, propagate());
+    this->take(obj);
+
+    return *this;
+}
+
+/**
+ * @brief Shares the nodes of another doubly linked list.
+ *
+ * The current contents are released once no other list refers to them. The
+ * allocator of `obj` is adopted when it propagates on copy assignment; with
+ * unequal allocators that do not propagate the values are copied instead.
+ *
+ * @param obj The `doubly_linked_list` object to share from.
+ * @return A reference to this `doubly_linked_list`.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> &doubly_linked_list<A, Allocator>::operator=(const doubly_linked_list<A, Allocator> &obj)
+{
+    typedef typename std::allocator_traits<Allocator>::propagate_on_container_copy_assignment propagate;
+
+    if (this == &obj || this->state == obj.state)
+        return *this;
+
+    this->release();
+
+    if (!propagate::value && this->alloc != obj.alloc)
+    {
+        this->reset();
+        this->extend(obj);
+
+        return *this;
+    }
+
+    linkedlist<A, Allocator>::propagate_copy(this->alloc, obj.alloc, propagate());
+    this->share(obj);
+
+    return *this;
+}
+
+/**
+ * @brief Assignment operator for assigning from an initializer list.
+ * @param values The initializer list containing the values to assign.
+ * @return A reference to this doubly_linked_list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> &doubly_linked_list<A, Allocator>::operator=(const std::initializer_list<A> &values)
+{
+    this->release();
+    this->reset();
+
+    this->extend(values);
+
+    return *this;
+}
+
+/**
+ * @brief Assignment operator for assigning from a static array.
+ * @tparam N The size of the array.
+ * @param array The static array containing the values to assign.
+ * @return A reference to this doubly_linked_list.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+doubly_linked_list<A, Allocator> &doubly_linked_list<A, Allocator>::operator=(const A (&array)[N])
+{
+    this->release();
+    this->reset();
+
+    this->extend(array);
+
+    return *this;
+}
+
+/**
+ * @brief Assignment operator for assigning from a vector.
+ * @param values The vector containing the values to assign.
+ * @return A reference to this doubly_linked_list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> &doubly_linked_list<A, Allocator>::operator=(const std::vector<A> &values)
+{
+    this->release();
+    this->reset();
+
+    this->extend(values);
+
+    return *this;
+}
+
+/**
+ * @brief Views a base node of this list as the doubly linked node it was allocated as.
+ *
+ * @param ptr A node owned by a doubly_linked_list, or nullptr.
+ * @return The same node with access to its `prev` link.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::dnode *doubly_linked_list<A, Allocator>::cast(typename linkedlist<A, Allocator>::node *ptr)
+{
+    return static_cast<dnode *>(ptr);
+}
+
+/**
+ * @brief Lexicographically compares two chains of nodes.
+ *
+ * @param left The first node of the left-hand chain.
+ * @param right The first node of the right-hand chain.
+ * @return true if the left chain orders strictly before the right chain, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::precedes(typename linkedlist<A, Allocator>::node *left, typename linkedlist<A, Allocator>::node *right)
+{
+    while (left != nullptr && right != nullptr)
+    {
+        if (left->value < right->value)
+            return true;
+        if (right->value < left->value)
+            return false;
+        left = left->next;
+        right = right->next;
+    }
+
+    return left == nullptr && right != nullptr;
+}
+
+/**
+ * @brief Locates the node at a specific index.
+ *
+ * Negative indices count from the end. The walk starts from whichever end
+ * of the list is closer to the requested position.
+ *
+ * @param index A valid index into the list.
+ * @return The node at the specified index.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::dnode *doubly_linked_list<A, Allocator>::getnode(const int64_t &index) const
+{
+    size_t position = (index < 0L) ? (size_t)(index + (int64_t)(this->state->length)) : (size_t)index;
+
+    dnode *ptr;
+    if (position <= this->state->length / 2)
+    {
+        ptr = cast(this->state->head);
+        for (size_t i = 0; i < position; i++)
+            ptr = cast(ptr->next);
+        LINKEDLIST_STAT_HOPS(position);
+    }
+
+    else
+    {
+        ptr = cast(this->state->tail);
+        for (size_t i = this->state->length - 1; i > position; i--)
+            ptr = ptr->prev;
+        LINKEDLIST_STAT_HOPS(this->state->length - 1 - position);
+    }
+
+    return ptr;
+}
+
+/**
+ * @brief Links a new node directly after an existing node.
+ *
+ * @param ptr The node to link after, or nullptr to link at the head.
+ * @param new_node The node to be linked in.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::link_after(dnode *ptr, dnode *new_node)
+{
+    new_node->prev = ptr;
+    new_node->next = (ptr == nullptr) ? this->state->head : ptr->next;
+
+    if (new_node->next != nullptr)
+        cast(new_node->next)->prev = new_node;
+    else
+        this->state->tail = new_node;
+
+    if (ptr != nullptr)
+        ptr->next = new_node;
+    else
+        this->state->head = new_node;
+
+    (this->state->length)++;
+}
+
+/**
+ * @brief Unlinks and frees a node of the list.
+ *
+ * @param ptr The node to be removed.
+ * @return The value held by the removed node.
+ */
+template <typename A, typename Allocator>
+A doubly_linked_list<A, Allocator>::unlink(dnode *ptr)
+{
+    if (ptr->prev != nullptr)
+        ptr->prev->next = ptr->next;
+    else
+        this->state->head = ptr->next;
+
+    if (ptr->next != nullptr)
+        cast(ptr->next)->prev = ptr->prev;
+    else
+        this->state->tail = ptr->prev;
+
+    A value = std::move(ptr->value);
+    this->deallocate(ptr);
+    LINKEDLIST_STAT_FREE();
+
+    (this->state->length)--;
+    return value;
+}
+
+/**
+ * @brief Prepend a value to the list.
+ * @param value The value to prepend.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::prepend(const A &value)
+{
+    dnode *new_node = this->template allocate<dnode>();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->link_after(nullptr, new_node);
+}
+
+/**
+ * @brief Append a value to the list.
+ * @param value The value to append.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::append(const A &value)
+{
+    dnode *new_node = this->template allocate<dnode>();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->link_after(cast(this->state->tail), new_node);
+}
+
+/**
+ * @brief Insert a value at a specific index.
+ *
+ * Follows the same index rules as `singly_linked_list::insert`, but the
+ * insertion point is reached from whichever end of the list is closer.
+ *
+ * @param index The position at which to insert the value.
+ * @param value The value to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert(const int64_t &index, const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert);
+
+    if (this->isempty() || index == 0L || index <= -(int64_t)(this->size()))
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (index == -1L || index >= (int64_t)(this->size()) - 1L)
+    {
+        this->append(value);
+        return;
+    }
+
+    dnode *new_node = this->template allocate<dnode>();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->link_after(this->getnode(index - 1L), new_node);
+}
+
+/**
+ * @brief Insert a linked list at a specific index.
+ * @param index The position at which to insert the linked list.
+ * @param obj The linked list to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert(const int64_t &index, const linkedlist<A, Allocator> &obj)
+{
+    int64_t curr_index = index;
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
+    while (ptr != nullptr)
+    {
+        this->insert(curr_index++, ptr->value);
+        ptr = ptr->next;
+    }
+}
+
+/**
+ * @brief Insert an initializer list of values at a specific index.
+ * @param index The position at which to insert the values.
+ * @param values The initializer list of values to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert(const int64_t &index, const std::initializer_list<A> &values)
+{
+    int64_t curr_index = index;
+    for (const A &value: values)
+        this->insert(curr_index++, value);
+}
+
+/**
+ * @brief Insert an array at a specific index.
+ * @tparam N The size of the array.
+ * @param index The position at which to insert the array.
+ * @param array The array of values to insert.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+void doubly_linked_list<A, Allocator>::insert(const int64_t &index, const A (&array)[N])
+{
+    int64_t curr_index = index;
+    for (const A &value: array)
+        this->insert(curr_index++, value);
+}
+
+/**
+ * @brief Insert a vector of values at a specific index.
+ * @param index The position at which to insert the vector.
+ * @param values The vector of values to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert(const int64_t &index, const std::vector<A> &values)
+{
+    int64_t curr_index = index;
+    for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
+        this->insert(curr_index++, *it);
+}
+
+/**
+ * @brief Insert a value into the list in sorted order.
+ * @param value The value to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert_in_order(const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert_in_order);
+
+    if (this->isempty() || (LINKEDLIST_STAT_COMPARE(), (this->state->head)->value >= value))
+    {
+        this->prepend(value);
+        return;
+    }
+
+    LINKEDLIST_STAT_COMPARE();
+    if ((this->state->tail)->value <= value)
+    {
+        this->append(value);
+        return;
+    }
+
+    dnode *ptr = cast(this->state->head);
+    while (ptr->next != nullptr && (LINKEDLIST_STAT_COMPARE(), ptr->next->value < value))
+    {
+        ptr = cast(ptr->next);
+        LINKEDLIST_STAT_HOP();
+    }
+
+    dnode *new_node = this->template allocate<dnode>();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->link_after(ptr, new_node);
+}
+
+/**
+ * @brief Insert a value into a list sorted by a comparator.
+ *
+ * The value goes before the first element that does not compare less than
+ * it, as with `insert_in_order(value)` and `<`.
+ *
+ * @param value The value to insert.
+ * @param comp A strict weak ordering; `comp(a, b)` is true if `a` goes before `b`.
+ */
+template <typename A, typename Allocator>
+template <typename Compare>
+void doubly_linked_list<A, Allocator>::insert_in_order(const A &value, Compare comp)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert_in_order);
+
+    if (this->isempty() || (LINKEDLIST_STAT_COMPARE(), !comp(this->state->head->value, value)))
+    {
+        this->prepend(value);
+        return;
+    }
+
+    LINKEDLIST_STAT_COMPARE();
+    if (!comp(value, this->state->tail->value))
+    {
+        this->append(value);
+        return;
+    }
+
+    dnode *ptr = cast(this->state->head);
+    while (ptr->next != nullptr && (LINKEDLIST_STAT_COMPARE(), comp(ptr->next->value, value)))
+    {
+        ptr = cast(ptr->next);
+        LINKEDLIST_STAT_HOP();
+    }
+
+    dnode *new_node = this->template allocate<dnode>();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->link_after(ptr, new_node);
+}
+
+/**
+ * @brief Insert a linked list into the list in sorted order.
+ * @param obj The linked list to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert_in_order(const linkedlist<A, Allocator> &obj)
+{
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
+    while (ptr != nullptr)
+    {
+        this->insert_in_order(ptr->value);
+        ptr = ptr->next;
+    }
+}
+
+/**
+ * @brief Insert an initializer list of values into the list in sorted order.
+ * @param values The initializer list of values to insert.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert_in_order(const std::initializer_list<A> &values)
+{
+    for (const A &value: values)
+        this->insert_in_order(value);
+}
+
+/**
+ * @brief Insert an array into the list in sorted order.
+ * @tparam N The size of the array.
+ * @param array The array of values to insert.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+void doubly_linked_list<A, Allocator>::insert_in_order(const A (&array)[N])
+{
+    for (const A &value: array)
+        this->insert_in_order(value);
+}
+
+/**
+ * @brief Insert a vector of values into the list in sorted order.
+ * @param values A vector containing the values to be inserted.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::insert_in_order(const std::vector<A> &values)
+{
+    for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
+        this->insert_in_order(*it);
+}
+
+/**
+ * @brief Extends the doubly linked list with the contents of another linked list.
+ * @param obj The linked list whose values are appended.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::extend(const linkedlist<A, Allocator> &obj)
+{
+    // Bounded by the original length so that extending a list with itself terminates
+    size_t remaining = len(obj);
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
+    while (remaining-- != 0)
+    {
+        this->append(ptr->value);
+        ptr = ptr->next;
+    }
+}
+
+/**
+ * @brief Extends the doubly linked list with the contents of an initializer list.
+ * @param values An initializer list containing the values to be appended.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::extend(const std::initializer_list<A> &values)
+{
+    for (const A &value: values)
+        this->append(value);
+}
+
+/**
+ * @brief Extends the doubly linked list with the contents of an array.
+ * @tparam N The size of the array.
+ * @param array An array containing the values to be appended.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+void doubly_linked_list<A, Allocator>::extend(const A (&array)[N])
+{
+    for (const A &value: array)
+        this->append(value);
+}
+
+/**
+ * @brief Extends the doubly linked list with the contents of a vector.
+ * @param values A vector containing the values to be appended.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::extend(const std::vector<A> &values)
+{
+    for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
+        this->append(*it);
+}
+
+/**
+ * @brief Removes the first occurrence of a specific value from the doubly linked list.
+ *
+ * @param value The value to be removed.
+ * @throws VALUE_ERROR If the list is empty or the value is not found.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::remove(const A &value)
+{
+    if (this->try_remove(value))
+        return;
+
+    throw VALUE_ERROR(this->isempty() ? "Removing from Empty List" : "Removing `x`, non-element in the List");
+}
+
+/**
+ * @brief Removes the first occurrence of a specific value, without throwing.
+ *
+ * @param value The value to be removed.
+ * @return true if a value was removed, false if the value is not in the list.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::try_remove(const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    dnode *ptr = cast(this->state->head);
+    while (ptr != nullptr && !(ptr->value == value))
+    {
+        ptr = cast(ptr->next);
+        LINKEDLIST_STAT_HOP();
+    }
+
+    if (ptr == nullptr)
+        return false;
+
+    this->unlink(ptr);
+    return true;
+}
+
+/**
+ * @brief Removes every occurrence of a value in a single pass.
+ *
+ * Unlike remove(), this does not throw when the value is absent.
+ *
+ * @param value The value to be removed.
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::remove_all(const A &value)
+{
+    return this->remove_if([&value](A &element) { return element == value; });
+}
+
+/**
+ * @brief Removes every value that satisfies a predicate in a single pass.
+ *
+ * If `pred` throws, the values removed so far stay removed and the list is
+ * left valid.
+ *
+ * @tparam Predicate A callable taking a value reference and returning bool.
+ * @param pred The predicate selecting the values to be removed.
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator>
+template <typename Predicate>
+size_t doubly_linked_list<A, Allocator>::remove_if(Predicate pred)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    size_t removed = 0;
+    typename linkedlist<A, Allocator>::node **link = &this->state->head;
+    dnode *kept = nullptr;
+    while (*link != nullptr)
+    {
+        dnode *ptr = cast(*link);
+        if (!pred(ptr->value))
+        {
+            kept = ptr;
+            link = &ptr->next;
+            LINKEDLIST_STAT_HOP();
+            continue;
+        }
+
+        *link = ptr->next;
+        if (ptr->next != nullptr)
+            cast(ptr->next)->prev = kept;
+        else
+            this->state->tail = kept;
+
+        this->deallocate(ptr);
+        LINKEDLIST_STAT_FREE();
+
+        (this->state->length)--;
+        removed++;
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Removes the values at positions `first` up to, not including, `last`.
+ *
+ * Bounds follow Python slicing: negative bounds count from the end and bounds
+ * past either end are clamped, so an empty range removes nothing. The range is
+ * reached from whichever end of the list is closer.
+ *
+ * @param first The position of the first value to be removed.
+ * @param last The position after the last value to be removed.
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::erase(const int64_t &first, const int64_t &last)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    size_t begin = linkedlist<A, Allocator>::bound(first, this->state->length);
+    size_t end = linkedlist<A, Allocator>::bound(last, this->state->length);
+    if (begin >= end)
+        return 0;
+
+    dnode *ptr = this->getnode((int64_t)begin), *kept = ptr->prev;
+    for (size_t i = begin; i < end; i++)
+    {
+        dnode *next_node = cast(ptr->next);
+        this->deallocate(ptr);
+        LINKEDLIST_STAT_FREE();
+        ptr = next_node;
+    }
+
+    if (kept != nullptr)
+        kept->next = ptr;
+    else
+        this->state->head = ptr;
+
+    if (ptr != nullptr)
+        ptr->prev = kept;
+    else
+        this->state->tail = kept;
+
+    this->state->length -= end - begin;
+    return end - begin;
+}
+
+/**
+ * @brief Inserts a value after the position of an iterator in O(1).
+ *
+ * Use before_begin() to insert at the front. Iterators stay valid.
+ *
+ * @param pos The iterator after which the value is inserted.
+ * @param value The value to insert.
+ * @return An iterator to the inserted value.
+ * @throws INDEX_ERROR If `pos` is end().
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator doubly_linked_list<A, Allocator>::insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const A &value)
+{
+    if (linkedlist<A, Allocator>::getlink(pos) == nullptr)
+        throw INDEX_ERROR("Inserting after the end of the List");
+
+    dnode *new_node = this->template allocate<dnode>();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->link_after(cast(linkedlist<A, Allocator>::unwrap(pos)), new_node);
+    return linkedlist<A, Allocator>::wrap(new_node);
+}
+
+/**
+ * @brief Inserts the values of an initializer list after the position of an iterator.
+ *
+ * @param pos The iterator after which the values are inserted.
+ * @param values The values to insert, in order.
+ * @return An iterator to the last inserted value, or `pos` if `values` is empty.
+ * @throws INDEX_ERROR If `pos` is end().
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator doubly_linked_list<A, Allocator>::insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const std::initializer_list<A> &values)
+{
+    return this->insert_after(pos, values.begin(), values.end());
+}
+
+/**
+ * @brief Inserts a range of values after the position of an iterator.
+ *
+ * @tparam InputIt An input iterator over values convertible to A.
+ * @param pos The iterator after which the values are inserted.
+ * @param first The beginning of the range.
+ * @param last The end of the range.
+ * @return An iterator to the last inserted value, or `pos` if the range is empty.
+ * @throws INDEX_ERROR If `pos` is end().
+ */
+template <typename A, typename Allocator>
+template <typename InputIt>
+typename linkedlist<A, Allocator>::iterator doubly_linked_list<A, Allocator>::insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, InputIt first, InputIt last)
+{
+    if (linkedlist<A, Allocator>::getlink(pos) == nullptr)
+        throw INDEX_ERROR("Inserting after the end of the List");
+
+    typename linkedlist<A, Allocator>::iterator it = linkedlist<A, Allocator>::wrap(pos);
+    for (; first != last; ++first)
+        it = this->insert_after(it, *first);
+
+    return it;
+}
+
+/**
+ * @brief Removes the value after the position of an iterator in O(1).
+ *
+ * @param pos The iterator before the value to be removed.
+ * @return An iterator to the value that followed the removed one.
+ * @throws INDEX_ERROR If there is no value after `pos`.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator doubly_linked_list<A, Allocator>::erase_after(const typename linkedlist<A, Allocator>::const_iterator &pos)
+{
+    typename linkedlist<A, Allocator>::node **link = linkedlist<A, Allocator>::getlink(pos);
+    if (link == nullptr || *link == nullptr)
+        throw INDEX_ERROR("Erasing after the last element of the List");
+
+    this->unlink(cast(*link));
+    return linkedlist<A, Allocator>::wrap(*link);
+}
+
+/**
+ * @brief Removes the values strictly between two iterators.
+ *
+ * @param first The iterator before the first value to be removed.
+ * @param last The iterator after the last value to be removed, which must be reachable from `first`.
+ * @return `last`.
+ * @throws INDEX_ERROR If `first` is end().
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator doubly_linked_list<A, Allocator>::erase_after(const typename linkedlist<A, Allocator>::const_iterator &first, const typename linkedlist<A, Allocator>::const_iterator &last)
+{
+    typename linkedlist<A, Allocator>::node **link = linkedlist<A, Allocator>::getlink(first);
+    if (link == nullptr)
+        throw INDEX_ERROR("Erasing after the end of the List");
+
+    typename linkedlist<A, Allocator>::node *stop = linkedlist<A, Allocator>::unwrap(last);
+    while (*link != stop)
+        this->unlink(cast(*link));
+
+    return linkedlist<A, Allocator>::wrap(last);
+}
+
+/**
+ * @brief Removes the first `count` values as one batch.
+ *
+ * The boundary is found once and the nodes are moved, not copied, into the
+ * returned list. Fewer values are removed if the list is shorter.
+ *
+ * @param count The number of values to be removed.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::pop_front_n(const size_t &count)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(0, std::min(count, this->state->length));
+}
+
+/**
+ * @brief Removes the first `count` values into a vector.
+ *
+ * @param count The number of values to be removed.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::pop_front_n(const size_t &count, std::vector<A> &values)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(0, std::min(count, this->state->length), values);
+}
+
+/**
+ * @brief Removes the last `count` values as one batch.
+ *
+ * @param count The number of values to be removed.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::pop_back_n(const size_t &count)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(this->state->length - std::min(count, this->state->length), this->state->length);
+}
+
+/**
+ * @brief Removes the last `count` values into a vector.
+ *
+ * @param count The number of values to be removed.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::pop_back_n(const size_t &count, std::vector<A> &values)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(this->state->length - std::min(count, this->state->length), this->state->length, values);
+}
+
+/**
+ * @brief Removes `count` values starting at `index` as one batch.
+ *
+ * Fewer values are removed if the list ends first.
+ *
+ * @param index The position of the first value, negative positions count from the end.
+ * @param count The number of values to be removed.
+ * @return A list holding the removed values in order.
+ * @throws INDEX_ERROR If the index is out of range.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::pop_range(const int64_t &index, const size_t &count)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    size_t begin = this->offset(index);
+    return this->detach(begin, begin + std::min(count, this->state->length - begin));
+}
+
+/**
+ * @brief Removes `count` values starting at `index` into a vector.
+ *
+ * @param index The position of the first value, negative positions count from the end.
+ * @param count The number of values to be removed.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ * @throws INDEX_ERROR If the index is out of range.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::pop_range(const int64_t &index, const size_t &count, std::vector<A> &values)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    size_t begin = this->offset(index);
+    return this->detach(begin, begin + std::min(count, this->state->length - begin), values);
+}
+
+/**
+ * @brief Shortens the list to at most `new_size` values.
+ *
+ * @param new_size The number of values to be kept.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::truncate(const size_t &new_size)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(std::min(new_size, this->state->length), this->state->length);
+}
+
+/**
+ * @brief Shortens the list to at most `new_size` values, moving the rest into a vector.
+ *
+ * @param new_size The number of values to be kept.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::truncate(const size_t &new_size, std::vector<A> &values)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(std::min(new_size, this->state->length), this->state->length, values);
+}
+
+/**
+ * @brief Unlinks the values at positions `begin` up to, not including, `end`.
+ *
+ * The range is reached from whichever end of the list is closer and its nodes
+ * are relinked into the returned list, which uses this list's allocator.
+ *
+ * @param begin The position of the first value, at most `end`.
+ * @param end The position after the last value, at most `size()`.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::detach(size_t begin, size_t end)
+{
+    doubly_linked_list<A, Allocator> removed(this->alloc);
+    if (begin >= end)
+        return removed;
+
+    dnode *first = this->getnode((int64_t)begin), *last = first;
+    for (size_t i = begin + 1; i < end; i++)
+        last = cast(last->next);
+    LINKEDLIST_STAT_HOPS(end - begin - 1);
+
+    dnode *kept = first->prev, *next_node = cast(last->next);
+    if (kept != nullptr)
+        kept->next = next_node;
+    else
+        this->state->head = next_node;
+
+    if (next_node != nullptr)
+        next_node->prev = kept;
+    else
+        this->state->tail = kept;
+
+    first->prev = nullptr;
+    last->next = nullptr;
+
+    removed.state->head = first;
+    removed.state->tail = last;
+    removed.state->length = end - begin;
+    this->state->length -= end - begin;
+
+    return removed;
+}
+
+/**
+ * @brief Removes the values at positions `begin` up to, not including, `end` into a vector.
+ *
+ * @param begin The position of the first value, at most `end`.
+ * @param end The position after the last value, at most `size()`.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::detach(size_t begin, size_t end, std::vector<A> &values)
+{
+    if (begin >= end)
+        return 0;
+
+    values.reserve(values.size() + (end - begin));
+
+    dnode *ptr = this->getnode((int64_t)begin), *kept = ptr->prev;
+    for (size_t i = begin; i < end; i++)
+    {
+        dnode *next_node = cast(ptr->next);
+        values.push_back(std::move(ptr->value));
+
+        if (kept != nullptr)
+            kept->next = next_node;
+        else
+            this->state->head = next_node;
+
+        if (next_node != nullptr)
+            next_node->prev = kept;
+        else
+            this->state->tail = kept;
+
+        this->deallocate(ptr);
+        LINKEDLIST_STAT_FREE();
+        (this->state->length)--;
+
+        ptr = next_node;
+    }
+
+    return end - begin;
+}
+
+/**
+ * @brief Pops and returns the value at a specific index from the doubly linked list.
+ *
+ * Negative indices count from the end. Both ends are reached in constant time.
+ *
+ * @param index The index of the node to be popped.
+ * @return The value of the node at the specified index.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator>
+A doubly_linked_list<A, Allocator>::pop(const int64_t &index)
+{
+    A value;
+    if (this->try_pop(index, value))
+        return value;
+
+    throw INDEX_ERROR(this->isempty() ? "Pop from Empty List" : "Pop index out of range");
+}
+
+/**
+ * @brief Pops and returns the last value from the doubly linked list.
+ *
+ * @return The value of the last node.
+ * @throws INDEX_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+A doubly_linked_list<A, Allocator>::pop()
+{
+    A value;
+    if (this->try_pop(value))
+        return value;
+
+    throw INDEX_ERROR("Pop from Empty List");
+}
+
+/**
+ * @brief Pops the value at a specific index, without throwing.
+ *
+ * Negative indices count from the end. On a miss `value` is left untouched.
+ *
+ * @param index The index of the node to be popped.
+ * @param value Receives the popped value.
+ * @return true if a value was popped, false if the index is out of range.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::try_pop(const int64_t &index, A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    if (index < -(int64_t)(this->size()) || index >= (int64_t)(this->size()))
+        return false;
+
+    value = this->unlink(this->getnode(index));
+    return true;
+}
+
+/**
+ * @brief Pops the last value, without throwing.
+ *
+ * @param value Receives the popped value.
+ * @return true if a value was popped, false if the list is empty.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::try_pop(A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    if (this->isempty())
+        return false;
+
+    value = this->unlink(cast(this->state->tail));
+    return true;
+}
+
+/**
+ * @brief Checks if the linked list contains a specific value.
+ *
+ * @param value The value to search for in the linked list.
+ * @return true if the value is found, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::contains(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::contains);
+
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        if (ptr->value == value)
+            return true;
+        ptr = ptr->next;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    return false;
+}
+
+/**
+ * @brief Finds the index of the first occurrence of a specific value.
+ *
+ * @param value The value to search for.
+ * @return The index of the value in the list.
+ * @throws VALUE_ERROR If the list is empty.
+ * @throws VALUE_ERROR If the specified value is not found in the list.
+ */
+template <typename A, typename Allocator>
+int64_t doubly_linked_list<A, Allocator>::index(const A &value) const
+{
+    size_t position;
+    if (this->try_index(value, position))
+        return (int64_t)position;
+
+    throw VALUE_ERROR(this->isempty() ? "Index of Element from Empty List" : "Value `x` not in List");
+}
+
+/**
+ * @brief Finds the index of the first occurrence of a value, without throwing.
+ *
+ * @param value The value to search for.
+ * @param index Receives the index of the value; left untouched on a miss.
+ * @return true if the value was found, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::try_index(const A &value, size_t &index) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::index);
+
+    size_t curr_index = 0;
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        if (ptr->value == value)
+        {
+            index = curr_index;
+            return true;
+        }
+
+        ptr = ptr->next;
+        curr_index++;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    return false;
+}
+
+/**
+ * @brief Counts the number of occurrences of a specific value.
+ *
+ * @param value The value to count.
+ * @return The number of occurrences of the value.
+ */
+template <typename A, typename Allocator>
+size_t doubly_linked_list<A, Allocator>::count(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::count);
+
+    size_t founds = 0;
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        if (ptr->value == value)
+            founds++;
+        ptr = ptr->next;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    return founds;
+}
+
+/**
+ * @brief Reverses the order of nodes in the doubly linked list.
+ *
+ * Swaps the `next` and `prev` links of every node in place.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::reverse()
+{
+    dnode *current = cast(this->state->head);
+    while (current != nullptr)
+    {
+        dnode *next_node = cast(current->next);
+        current->next = current->prev;
+        current->prev = next_node;
+        current = next_node;
+    }
+
+    std::swap(this->state->head, this->state->tail);
+}
+
+/**
+ * @brief Sorts the doubly linked list in ascending order.
+ *
+ * Runs a bottom-up merge sort over the `next` links, then restores the `prev`
+ * links and the tail in a single pass.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::sort()
+{
+    this->sort([](A &left, A &right) { return !(right <= left); });
+}
+
+/**
+ * @brief Sorts the doubly linked list by a comparator.
+ *
+ * Same stable merge sort as sort(), ordering by `comp` instead of `<=`, e.g.
+ * by a single field or in descending order.
+ *
+ * @param comp A strict weak ordering; `comp(a, b)` is true if `a` goes before `b`.
+ */
+template <typename A, typename Allocator>
+template <typename Compare>
+void doubly_linked_list<A, Allocator>::sort(Compare comp)
+{
+    if (this->state->length < 2)
+        return;
+
+    typename linkedlist<A, Allocator>::node *sorted = this->state->head;
+    for (size_t width = 1; width < this->state->length; width *= 2)
+    {
+        typename linkedlist<A, Allocator>::node *remaining = sorted, **link = &sorted;
+        while (remaining != nullptr)
+        {
+            typename linkedlist<A, Allocator>::node *left = remaining, *right = remaining;
+            for (size_t i = 1; i < width && right->next != nullptr; i++)
+                right = right->next;
+
+            typename linkedlist<A, Allocator>::node *left_end = right;
+            right = right->next;
+            left_end->next = nullptr;
+
+            remaining = right;
+            for (size_t i = 1; i < width && remaining != nullptr; i++)
+                remaining = remaining->next;
+
+            if (remaining != nullptr)
+            {
+                typename linkedlist<A, Allocator>::node *next_run = remaining->next;
+                remaining->next = nullptr;
+                remaining = next_run;
+            }
+
+            while (left != nullptr && right != nullptr)
+            {
+                LINKEDLIST_STAT_COMPARE();
+                if (!comp(right->value, left->value))
+                {
+                    *link = left;
+                    left = left->next;
+                }
+
+                else
+                {
+                    *link = right;
+                    right = right->next;
+                }
+
+                link = &(*link)->next;
+            }
+
+            *link = (left != nullptr) ? left : right;
+            while (*link != nullptr)
+                link = &(*link)->next;
+        }
+    }
+
+    dnode *prev = nullptr, *ptr = cast(sorted);
+    while (ptr != nullptr)
+    {
+        ptr->prev = prev;
+        prev = ptr;
+        ptr = cast(ptr->next);
+    }
+
+    this->state->head = sorted;
+    this->state->tail = prev;
+}
+
+/**
+ * @brief Sorts the doubly linked list by a key computed from each value.
+ *
+ * `key` is called exactly once per element. The keys are cached next to their
+ * node pointers in a scratch array from the list's allocator, which is stably
+ * sorted by key with `<` before both links of every node are rewritten.
+ *
+ * @param key Maps a value to the key it is ordered by.
+ */
+template <typename A, typename Allocator>
+template <typename KeyFn>
+void doubly_linked_list<A, Allocator>::sort_by_key(KeyFn key)
+{
+    typedef typename std::decay<decltype(key(this->state->head->value))>::type key_type;
+    typedef std::pair<key_type, dnode *> entry;
+
+    if (this->state->length < 2)
+        return;
+
+    std::vector<entry, typename std::allocator_traits<Allocator>::template rebind_alloc<entry>> entries(this->alloc);
+    entries.reserve(this->state->length);
+    for (dnode *ptr = cast(this->state->head); ptr != nullptr; ptr = cast(ptr->next))
+        entries.emplace_back(key(ptr->value), ptr);
+
+    std::stable_sort(entries.begin(), entries.end(), [](const entry &left, const entry &right)
+    {
+        LINKEDLIST_STAT_COMPARE();
+        return left.first < right.first;
+    });
+
+    dnode *prev = nullptr;
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i].second->prev = prev;
+        if (prev != nullptr)
+            prev->next = entries[i].second;
+        prev = entries[i].second;
+    }
+
+    prev->next = nullptr;
+    this->state->head = entries.front().second;
+    this->state->tail = prev;
+}
+
+/**
+ * @brief Creates an independent copy of the doubly linked list.
+ *
+ * @return A new doubly linked list holding copies of the values.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::copy() const
+{
+    doubly_linked_list<A, Allocator> list_obj(std::allocator_traits<Allocator>::select_on_container_copy_construction(this->alloc));
+    list_obj.extend(*this);
+
+    return list_obj;
+}
+
+/**
+ * @brief Accesses the value at a specific index in the doubly linked list.
+ *
+ * Negative indices count from the end. The walk starts from whichever end
+ * of the list is closer to the requested position.
+ *
+ * @param index The index of the value to be accessed.
+ * @return A reference to the value at the specified index.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator>
+A &doubly_linked_list<A, Allocator>::operator[](const int64_t &index)
+{
+    A *value = this->try_at(index);
+    if (value != nullptr)
+        return *value;
+
+    throw INDEX_ERROR(this->isempty() ? "Indexing an Empty List" : "List index out of range");
+}
+
+/**
+ * @brief Accesses the value at a specific index, without throwing.
+ *
+ * Negative indices count from the end. The walk starts from whichever end
+ * of the list is closer to the requested position.
+ *
+ * @param index The index of the value to be accessed.
+ * @return A pointer to the value, or nullptr if the index is out of range.
+ */
+template <typename A, typename Allocator>
+A *doubly_linked_list<A, Allocator>::try_at(const int64_t &index)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
+
+    if (index < -(int64_t)(this->size()) || index >= (int64_t)(this->size()))
+        return nullptr;
+
+    return &this->getnode(index)->value;
+}
+
+/**
+ * @brief Concatenates two linked lists into a new doubly linked list.
+ *
+ * @param obj The linked list to be concatenated.
+ * @return A new doubly linked list containing the concatenated result.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::operator+(const linkedlist<A, Allocator> &obj) const
+{
+    doubly_linked_list<A, Allocator> list_obj = this->copy();
+    list_obj.extend(obj);
+
+    return list_obj;
+}
+
+/**
+ * @brief Repeats the doubly linked list a specified number of times.
+ *
+ * @param times The number of times to repeat the list.
+ * @return A new doubly linked list containing the repeated list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> doubly_linked_list<A, Allocator>::operator*(const size_t &times)
+{
+    doubly_linked_list<A, Allocator> list_obj(std::allocator_traits<Allocator>::select_on_container_copy_construction(this->alloc));
+    for (size_t i = 0; i < times; i++)
+        list_obj.extend(*this);
+
+    return list_obj;
+}
+
+/**
+ * @brief Checks if the current list is lexicographically greater than the provided list.
+ *
+ * @param obj The linked list to compare with.
+ * @return true if the current list is greater than the provided list, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::operator>(const linkedlist<A, Allocator> &obj) const
+{
+    return doubly_linked_list<A, Allocator>::precedes(*linkedlist<A, Allocator>::gethead(obj), this->state->head);
+}
+
+/**
+ * @brief Checks if the current list is lexicographically less than the provided list.
+ *
+ * @param obj The linked list to compare with.
+ * @return true if the current list is less than the provided list, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::operator<(const linkedlist<A, Allocator> &obj) const
+{
+    return doubly_linked_list<A, Allocator>::precedes(this->state->head, *linkedlist<A, Allocator>::gethead(obj));
+}
+
+/**
+ * @brief Checks if the current list is lexicographically greater than or equal to the provided list.
+ *
+ * @param obj The linked list to compare with.
+ * @return true if the current list is greater than or equal to the provided list, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::operator>=(const linkedlist<A, Allocator> &obj) const
+{
+    return !doubly_linked_list<A, Allocator>::precedes(this->state->head, *linkedlist<A, Allocator>::gethead(obj));
+}
+
+/**
+ * @brief Checks if the current list is lexicographically less than or equal to the provided list.
+ *
+ * @param obj The linked list to compare with.
+ * @return true if the current list is less than or equal to the provided list, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::operator<=(const linkedlist<A, Allocator> &obj) const
+{
+    return !doubly_linked_list<A, Allocator>::precedes(*linkedlist<A, Allocator>::gethead(obj), this->state->head);
+}
+
+/**
+ * @brief Checks if the current list is equal to the provided list.
+ *
+ * @param obj The linked list to compare with.
+ * @return true if both lists hold equal values in the same order, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::operator==(const linkedlist<A, Allocator> &obj) const
+{
+    typename linkedlist<A, Allocator>::node *ptr1 = this->state->head, *ptr2 = *linkedlist<A, Allocator>::gethead(obj);
+    while (ptr1 != nullptr && ptr2 != nullptr)
+    {
+        if (!(ptr1->value == ptr2->value))
+            return false;
+        ptr1 = ptr1->next;
+        ptr2 = ptr2->next;
+    }
+
+    return ptr1 == ptr2;
+}
+
+/**
+ * @brief Checks if the current list is not equal to the provided list.
+ *
+ * @param obj The linked list to compare with.
+ * @return true if the lists differ, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool doubly_linked_list<A, Allocator>::operator!=(const linkedlist<A, Allocator> &obj) const
+{
+    return !(*this == obj);
+}
+
+/**
+ * @brief Converts the doubly linked list to a std::array.
+ *
+ * @throw INDEX_ERROR If N is less than the number of elements in the linked list.
+ *
+ * @return A std::array containing the elements of the doubly linked list.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+doubly_linked_list<A, Allocator>::operator std::array<A, N>()
+{
+    if (N < this->state->length)
+        throw INDEX_ERROR("Insufficient Array Capacity");
+
+    size_t index = 0;
+    std::array<A, N> arr;
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        arr[index++] = ptr->value;
+        ptr = ptr->next;
+    }
+
+    return arr;
+}
+
+/**
+ * @brief Converts the doubly linked list to a dynamically allocated array.
+ *
+ * @return A pointer to a dynamically allocated array containing the elements
+ *         of the doubly linked list. The caller is responsible for deallocating the memory.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::operator A *()
+{
+    size_t index = 0;
+    A *arr = new A[this->state->length];
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        arr[index++] = ptr->value;
+        ptr = ptr->next;
+    }
+
+    return arr;
+}
+
+/**
+ * @brief Converts the doubly linked list to a vector.
+ *
+ * @return A vector containing the elements of the linked list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::operator std::vector<A>()
+{
+    std::vector<A> vect;
+    vect.reserve(this->state->length);
+
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        vect.push_back(ptr->value);
+        ptr = ptr->next;
+    }
+
+    return vect;
+}
+
+/**
+ * @brief Converts the doubly linked list to a string representation.
+ *
+ * @return A string representing the list's contents.
+ */
+template <typename A, typename Allocator>
+std::string doubly_linked_list<A, Allocator>::to_string()
+{
+    std::ostringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+/**
+ * @brief Displays the doubly linked list.
+ *
+ * This method prints the list to the standard output using the `<<` operator.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::show()
+{
+    std::cout << *this;
+}
+
+/**
+ * @brief Clears the doubly linked list.
+ *
+ * This method removes all elements from the list and releases allocated memory.
+ */
+template <typename A, typename Allocator>
+void doubly_linked_list<A, Allocator>::clear()
+{
+    dnode *ptr = cast(this->state->head);
+    while (ptr != nullptr)
+    {
+        dnode *temp = ptr;
+        ptr = cast(ptr->next);
+        this->deallocate(temp);
+        LINKEDLIST_STAT_FREE();
+    }
+
+    this->state->head = this->state->tail = nullptr;
+    this->state->length = 0;
+}
+
+/**
+ * @brief Reports the bytes held by the list.
+ *
+ * A control block shared with copies of the list is counted by each of them.
+ *
+ * @return The bytes used by values, links, node padding and control structures.
+ */
+template <typename A, typename Allocator>
+list_memory doubly_linked_list<A, Allocator>::memory_usage() const
+{
+    list_memory usage = list_memory();
+    usage.payload = this->state->length * sizeof(A);
+    usage.links = this->state->length * 2 * sizeof(dnode *);
+    usage.padding = this->state->length * (sizeof(dnode) - sizeof(A) - 2 * sizeof(dnode *));
+    usage.control = sizeof(*this);
+
+    if (this->state != &this->inline_state)
+        usage.control += sizeof(typename linkedlist<A, Allocator>::control);
+    if (this->state->extra != nullptr)
+        usage.control += sizeof(typename linkedlist<A, Allocator>::extension);
+
+    return usage;
+}
+
+/**
+ * @brief Get a reverse_iterator to the last element of the doubly linked list.
+ *
+ * @return doubly_linked_list<A, Allocator>::reverse_iterator A reverse_iterator to the last element.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::reverse_iterator doubly_linked_list<A, Allocator>::rbegin()
+{
+    return reverse_iterator(cast(this->state->tail));
+}
+
+/**
+ * @brief Get a reverse_iterator to the position before the first element.
+ *
+ * @return doubly_linked_list<A, Allocator>::reverse_iterator A reverse_iterator to the reverse end of the list.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::reverse_iterator doubly_linked_list<A, Allocator>::rend()
+{
+    return reverse_iterator(nullptr);
+}
+
+/**
+ * @brief Get a const_reverse_iterator to the last element of the doubly linked list.
+ *
+ * @return doubly_linked_list<A, Allocator>::const_reverse_iterator A const_reverse_iterator to the last element.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::const_reverse_iterator doubly_linked_list<A, Allocator>::crbegin() const
+{
+    return const_reverse_iterator(cast(this->state->tail));
+}
+
+/**
+ * @brief Get a const_reverse_iterator to the position before the first element.
+ *
+ * @return doubly_linked_list<A, Allocator>::const_reverse_iterator A const_reverse_iterator to the reverse end of the list.
+ */
+template <typename A, typename Allocator>
+typename doubly_linked_list<A, Allocator>::const_reverse_iterator doubly_linked_list<A, Allocator>::crend() const
+{
+    return const_reverse_iterator(nullptr);
+}
+
+/**
+ * @brief Repeats a doubly linked list a specified number of times.
+ *
+ * @param times The number of times to repeat the list.
+ * @param obj The doubly linked list to be repeated.
+ * @return A new doubly linked list containing the repeated list.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator> operator*(const size_t &times, doubly_linked_list<A, Allocator> &obj)
+{
+    return obj * times;
+}
+
+/**
+ * @brief Outputs the doubly linked list to an output stream.
+ *
+ * @param out The output stream to which the list will be written.
+ * @param obj The doubly linked list to be printed.
+ * @return The output stream with the list data.
+ */
+template <typename A, typename Allocator>
+std::ostream &operator<<(std::ostream &out, doubly_linked_list<A, Allocator> &obj)
+{
+    out << "[";
+
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
+    while (ptr != nullptr)
+    {
+        out << ptr->value;
+        if (ptr->next != nullptr)
+            out << ", ";
+        ptr = ptr->next;
+    }
+
+    out << "]";
+
+    return out;
+}
+
+/**
+ * @brief Destructor for doubly linked list.
+ *
+ * Releases the nodes and bookkeeping once no other list shares them.
+ */
+template <typename A, typename Allocator>
+doubly_linked_list<A, Allocator>::~doubly_linked_list()
+{
+    this->release();
+}
@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "doubly_linked_list.hpp"
+
+/**
+ * @file doubly_linked_list_example.cpp
+ * @brief Demonstrates the usage of a doubly linked list.
+ *
+ * This program shows the operations where a doubly linked list differs from a
+ * singly linked list: popping from either end in constant time, iterating in
+ * reverse, and negative indexing that walks from the tail.
+ *
+ * @sa pop_example.cpp for popping from a singly linked list.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    // Use the list as a deque of pending jobs
+    doubly_linked_list<std::string> jobs = {"build", "test", "package"};
+    jobs.append("deploy");
+    jobs.prepend("fetch");
+    std::cout << "jobs: " << jobs << std::endl; // jobs: [fetch, build, test, package, deploy]
+
+    // Both ends are popped without walking the list
+    std::cout << "last job: " << jobs.pop() << std::endl; // last job: deploy
+    std::cout << "first job: " << jobs.pop(0) << std::endl; // first job: fetch
+    std::cout << "jobs: " << jobs << std::endl; // jobs: [build, test, package]
+
+    // Negative indices start walking from the tail
+    doubly_linked_list<int> squares = {1, 4, 9, 16, 25, 36};
+    std::cout << "squares[-2]: " << squares[-2] << std::endl; // squares[-2]: 25
+
+    // Iterate from the last element to the first
+    std::cout << "squares reversed:";
+    for (doubly_linked_list<int>::reverse_iterator it = squares.rbegin(); it != squares.rend(); ++it)
+        std::cout << " " << *it;
+    std::cout << std::endl; // squares reversed: 36 25 16 9 4 1
+
+    // Reverse iterators work with the standard algorithms and containers
+    std::vector<int> descending(squares.rbegin(), squares.rend());
+    std::cout << "descending.front(): " << descending.front() << std::endl; // descending.front(): 36
+    std::cout << "first square below 10 from the end: " << *std::find_if(squares.crbegin(), squares.crend(), [](const int &value) { return value < 10; }) << std::endl; // first square below 10 from the end: 9
+
+    return 0;
+}
@@ -5,6 +5,8 @@
 #include <stdexcept>
 #include <sstream>
 
+#include "./stats.hpp"
+
 class Exception: public std::runtime_error
 {
     private:
@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+
+#include "singly_linked_list.hpp"
+
+/**
+ * @file iterator_example.cpp
+ * @brief Demonstrates iterators, std algorithms and positional edits in singly linked list.
+ *
+ * The iterators are standard forward iterators, so std algorithms work on the
+ * list directly. `insert_after` and `erase_after` edit the list at an iterator
+ * in constant time, and `before_begin` is the position before the first value.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    singly_linked_list<int> list1 = {1, 2, 3, 4, 5, 6};
+
+    // std algorithms over the list
+    std::cout << std::accumulate(list1.cbegin(), list1.cend(), 0) << std::endl; // 21
+    std::cout << std::count_if(list1.begin(), list1.end(), [](int value) { return value % 2 == 0; }) << std::endl; // 3
+    std::cout << *std::find(list1.begin(), list1.end(), 4) << std::endl; // 4
+
+    // Remove the even values and double the odd ones in a single pass
+    for (singly_linked_list<int>::iterator prev = list1.before_begin(), it = list1.begin(); it != list1.end();)
+    {
+        if (*it % 2 == 0)
+            it = list1.erase_after(prev);
+        else
+        {
+            *it *= 2;
+            prev = it++;
+        }
+    }
+    std::cout << "list1: " << list1 << std::endl; // list1: [2, 6, 10]
+
+    // Insert at the front and after the second value
+    list1.insert_after(list1.before_begin(), 0);
+    list1.insert_after(std::next(list1.begin(), 2), {7, 8});
+    std::cout << "list1: " << list1 << std::endl; // list1: [0, 2, 6, 7, 8, 10]
+
+    // Drop everything after the first value
+    list1.erase_after(list1.begin(), list1.end());
+    std::cout << "list1: " << list1 << std::endl; // list1: [0]
+
+    return 0;
+}
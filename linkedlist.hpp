@@ -1,7 +1,14 @@
 #ifndef LINKEDLIST_H
 #define LINKEDLIST_H
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "./exception.hpp"
@@ -9,7 +16,25 @@
 typedef signed long int64_t;
 typedef unsigned long size_t;
 
-template <typename A>
+#include "./static_list.hpp"
+
+/**
+ * @brief The bytes a list holds, by what they are used for.
+ *
+ * Bookkeeping inside the allocator itself, such as malloc headers, is not included.
+ */
+struct list_memory
+{
+    size_t payload;   ///< Bytes holding the values
+    size_t links;     ///< Bytes holding the links between nodes
+    size_t padding;   ///< Alignment padding inside nodes
+    size_t reserved;  ///< Node storage allocated but not holding a value
+    size_t control;   ///< The list object and any control blocks it allocated
+
+    size_t total() const;
+};
+
+template <typename A, typename Allocator = std::allocator<A>>
 class linkedlist
 {
     protected:
@@ -19,26 +44,105 @@ class linkedlist
             struct node *next;
         } node;
 
-        node **head, **tail;
+        typedef struct slab
+        {
+            node *nodes;
+            size_t capacity, live;
+            struct slab *next;
+        } slab;
 
-        constexpr static node **gethead(const linkedlist<A> &obj);
+        typedef struct extension
+        {
+            slab *slabs;
+            size_t digest, digest_power;
+            bool digest_valid;
+            bool ascending, descending;  // Known to be in non-decreasing / non-increasing order
+        } extension;
+
+        typedef struct control
+        {
+            node *head, *tail;
+            size_t length, ref_count;
+            extension *extra;  // Bookkeeping of opt-in features, allocated on first use
+        } control;
+
+        Allocator alloc;
+        control inline_state;
+        mutable control *state;
+
+        explicit linkedlist(const Allocator &alloc = Allocator());
+
+        template <typename T>
+        T *allocate() const;
+        template <typename T>
+        void deallocate(T *ptr) const;
+
+        void share(const linkedlist<A, Allocator> &obj);
+        void take(linkedlist<A, Allocator> &obj);
+        void release();
+        void reset();
+
+        extension &extras() const;
+        void forget_order() const;
+
+        static void propagate_copy(Allocator &to, const Allocator &from, std::true_type);
+        static void propagate_copy(Allocator &to, const Allocator &from, std::false_type);
+        static void propagate_move(Allocator &to, Allocator &from, std::true_type);
+        static void propagate_move(Allocator &to, Allocator &from, std::false_type);
+
+        // Order-sensitive digest: sum of digest_term(value_i) * digest_base^(length - 1 - i), mod 2^64
+        static constexpr size_t digest_base = 0x100000001b3UL;
+        static constexpr size_t digest_inverse = 0xce965057aff6957bUL;
+
+        template <typename T>
+        static constexpr auto hashable(int) -> decltype(std::hash<T>()(std::declval<const T &>()), true) { return true; }
+        template <typename T>
+        static constexpr bool hashable(long) { return false; }
+
+        static size_t digest_term(const A &value);
+        static size_t digest_term(const A &value, std::true_type);
+        static size_t digest_term(const A &value, std::false_type);
+        size_t digest() const;
+        virtual bool tracks_hash() const;
+        bool digest_differs(const linkedlist<A, Allocator> &obj) const;
+
+        static size_t bound(const int64_t &index, const size_t &length);
+        size_t offset(const int64_t &index) const;
+
+        constexpr static node **gethead(const linkedlist<A, Allocator> &obj);
         constexpr static node *getmiddle(node *head);
-        constexpr static node **gettail(const linkedlist<A> &obj);
+        constexpr static node **gettail(const linkedlist<A, Allocator> &obj);
     public:
+        typedef A value_type;
+        typedef Allocator allocator_type;
+
+        class const_iterator;
+
         class iterator
         {
             private:
-                linkedlist<A>::node *ptr;
+                linkedlist<A, Allocator>::node *ptr;
+                const linkedlist<A, Allocator> *list;
+
+                iterator(linkedlist<A, Allocator>::node *ptr, const linkedlist<A, Allocator> *list = nullptr);
 
-                iterator(linkedlist<A>::node *ptr);
+                friend class linkedlist<A, Allocator>;
+                friend class const_iterator;
             public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef A *pointer;
+                typedef A &reference;
+
                 iterator();
 
-                constexpr iterator &operator++();
-                constexpr iterator &operator++(int);
-                constexpr A &operator*();
-                constexpr bool operator==(const iterator &it) const;
-                constexpr bool operator!=(const iterator &it) const;
+                iterator &operator++();
+                iterator operator++(int);
+                A &operator*() const;
+                A *operator->() const;
+                bool operator==(const iterator &it) const;
+                bool operator!=(const iterator &it) const;
 
                 ~iterator() = default;
         };
@@ -46,61 +150,83 @@ class linkedlist
         class const_iterator
         {
             private:
-                const linkedlist<A>::node *ptr;
+                const linkedlist<A, Allocator>::node *ptr;
+                const linkedlist<A, Allocator> *list;
 
-                const_iterator(linkedlist<A>::node *ptr);
+                const_iterator(const linkedlist<A, Allocator>::node *ptr, const linkedlist<A, Allocator> *list = nullptr);
+
+                friend class linkedlist<A, Allocator>;
             public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const A *pointer;
+                typedef const A &reference;
+
                 const_iterator();
+                const_iterator(const iterator &it);
 
-                constexpr const const_iterator &operator++();
-                constexpr const const_iterator &operator++(int);
-                constexpr const A &operator*() const;
-                constexpr bool operator==(const const_iterator &it) const;
-                constexpr bool operator!=(const const_iterator &it) const;
+                const_iterator &operator++();
+                const_iterator operator++(int);
+                const A &operator*() const;
+                const A *operator->() const;
+                bool operator==(const const_iterator &it) const;
+                bool operator!=(const const_iterator &it) const;
 
                 ~const_iterator() = default;
         };
-
-        linkedlist();
-
+    protected:
+        static iterator wrap(node *ptr);
+        static iterator wrap(const const_iterator &pos);
+        static node *unwrap(const const_iterator &pos);
+        static node **getlink(const const_iterator &pos);
+    public:
         virtual void prepend(const A &value) = 0;
         virtual void append(const A &value) = 0;
         virtual void insert(const int64_t &index, const A &value) = 0;
-        virtual void insert(const int64_t &index, const linkedlist<A> &obj) = 0;
+        virtual void insert(const int64_t &index, const linkedlist<A, Allocator> &obj) = 0;
         virtual void insert(const int64_t &index, const std::initializer_list<A> &values) = 0;
         virtual void insert(const int64_t &index, const std::vector<A> &values) = 0;
 
         virtual void insert_in_order(const A &value) = 0;
-        virtual void insert_in_order(const linkedlist<A> &obj) = 0;
+        virtual void insert_in_order(const linkedlist<A, Allocator> &obj) = 0;
         virtual void insert_in_order(const std::initializer_list<A> &values) = 0;
         virtual void insert_in_order(const std::vector<A> &values) = 0;
 
-        virtual void extend(const linkedlist<A> &obj) = 0;
+        virtual void extend(const linkedlist<A, Allocator> &obj) = 0;
         virtual void extend(const std::initializer_list<A> &values) = 0;
         virtual void extend(const std::vector<A> &values) = 0;
 
         virtual void remove(const A &value) = 0;
         virtual A pop(const int64_t &index) = 0;
         virtual A pop() = 0;
+        virtual size_t remove_all(const A &value) = 0;
+        virtual size_t erase(const int64_t &first, const int64_t &last) = 0;
+
+        virtual bool try_pop(const int64_t &index, A &value) = 0;
+        virtual bool try_pop(A &value) = 0;
+        virtual bool try_remove(const A &value) = 0;
 
-        constexpr virtual size_t size() const;
+        constexpr size_t size() const;
         
         constexpr bool isempty() const;
 
         virtual bool contains(const A &value) const = 0;
         virtual int64_t index(const A &value) const = 0;
         virtual size_t count(const A &value) const = 0;
+        virtual bool try_index(const A &value, size_t &index) const = 0;
         
         virtual void reverse() = 0;
         virtual void sort() = 0;
 
         virtual A &operator[](const int64_t &index) = 0;
-        virtual bool operator>(const linkedlist<A> &obj) const = 0;
-        virtual bool operator<(const linkedlist<A> &obj) const = 0;
-        virtual bool operator>=(const linkedlist<A> &obj) const = 0;
-        virtual bool operator<=(const linkedlist<A> &obj) const = 0;
-        virtual bool operator==(const linkedlist<A> &obj) const = 0;
-        virtual bool operator!=(const linkedlist<A> &obj) const = 0;
+        virtual A *try_at(const int64_t &index) = 0;
+        virtual bool operator>(const linkedlist<A, Allocator> &obj) const = 0;
+        virtual bool operator<(const linkedlist<A, Allocator> &obj) const = 0;
+        virtual bool operator>=(const linkedlist<A, Allocator> &obj) const = 0;
+        virtual bool operator<=(const linkedlist<A, Allocator> &obj) const = 0;
+        virtual bool operator==(const linkedlist<A, Allocator> &obj) const = 0;
+        virtual bool operator!=(const linkedlist<A, Allocator> &obj) const = 0;
 
         virtual operator A *() = 0;
         virtual operator std::vector<A>() = 0;
@@ -110,31 +236,52 @@ class linkedlist
 
         virtual void clear() = 0;
 
-        constexpr linkedlist<A>::iterator begin();
-        constexpr linkedlist<A>::iterator end();
-        constexpr const linkedlist<A>::const_iterator cbegin() const;
-        constexpr const linkedlist<A>::const_iterator cend() const;
+        virtual list_memory memory_usage() const = 0;
 
-        template <typename B>
-        friend B min(const linkedlist<B> &obj);
+        allocator_type get_allocator() const;
 
-        template <typename B>
-        friend B max(const linkedlist<B> &obj);
+        linkedlist<A, Allocator>::iterator begin();
+        linkedlist<A, Allocator>::iterator end();
+        linkedlist<A, Allocator>::const_iterator begin() const;
+        linkedlist<A, Allocator>::const_iterator end() const;
+        linkedlist<A, Allocator>::const_iterator cbegin() const;
+        linkedlist<A, Allocator>::const_iterator cend() const;
+        linkedlist<A, Allocator>::iterator before_begin();
+        linkedlist<A, Allocator>::const_iterator before_begin() const;
+        linkedlist<A, Allocator>::const_iterator cbefore_begin() const;
 
-        template <typename B>
-        friend size_t len(const linkedlist<B> &obj);
+        template <typename B, typename C>
+        friend B min(const linkedlist<B, C> &obj);
+
+        template <typename B, typename C>
+        friend B max(const linkedlist<B, C> &obj);
+
+        template <typename B, typename C>
+        friend size_t len(const linkedlist<B, C> &obj);
 
         virtual ~linkedlist() = default;
 };
 
-template <typename A>
-A min(const linkedlist<A> &oAj);
+template <typename A, typename Allocator>
+A min(const linkedlist<A, Allocator> &oAj);
+
+template <typename A, typename Allocator>
+A max(const linkedlist<A, Allocator> &obj);
 
-template <typename A>
-A max(const linkedlist<A> &obj);
+template <typename A, typename Allocator>
+size_t len(const linkedlist<A, Allocator> &obj);
 
-template <typename A>
-size_t len(const linkedlist<A> &obj);
+#if __cplusplus >= 201703L && defined(__has_include)
+    #if __has_include(<memory_resource>)
+        #include <memory_resource>
+
+        namespace pmr
+        {
+            template <typename A>
+            using linkedlist = ::linkedlist<A, std::pmr::polymorphic_allocator<A>>;
+        }
+    #endif
+#endif
 
 #include "./linkedlist.tpp"
 
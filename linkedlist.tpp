@@ -1,39 +1,63 @@
 #include "linkedlist.hpp"
 
 
+/**
+ * @brief Returns the total number of bytes.
+ * @return The sum of every category.
+ */
+inline size_t list_memory::total() const
+{
+    return this->payload + this->links + this->padding + this->reserved + this->control;
+}
+
 /**
  * @brief Constructor for the const_iterator.
  * 
  * Initializes the const_iterator with the pointer to nullptr.
- * 
- * @param ptr A pointer to the node the const_iterator will point to.
  */
-template <typename A>
-linkedlist<A>::const_iterator::const_iterator():
-    ptr(nullptr) {}
+template <typename A, typename Allocator>
+linkedlist<A, Allocator>::const_iterator::const_iterator():
+    ptr(nullptr), list(nullptr) {}
 
 /**
  * @brief Constructor for the const_iterator.
  * 
  * Initializes the const_iterator with the pointer to a node in the linked list.
+ * A null node together with a list is the position before the first element.
  * 
  * @param ptr A pointer to the node the const_iterator will point to.
+ * @param list The list whose head follows the position, for before_begin().
+ */
+template <typename A, typename Allocator>
+linkedlist<A, Allocator>::const_iterator::const_iterator(const typename linkedlist<A, Allocator>::node *ptr, const linkedlist<A, Allocator> *list):
+    ptr(ptr), list(list) {}
+
+/**
+ * @brief Converts an iterator to a const_iterator at the same position.
+ * 
+ * @param it The iterator to convert.
  */
-template <typename A>
-linkedlist<A>::const_iterator::const_iterator(typename linkedlist<A>::node *ptr):
-    ptr(ptr) {}
+template <typename A, typename Allocator>
+linkedlist<A, Allocator>::const_iterator::const_iterator(const typename linkedlist<A, Allocator>::iterator &it):
+    ptr(it.ptr), list(it.list) {}
 
 /**
  * @brief Prefix increment operator for the const_iterator.
  * 
  * Advances the const_iterator to the next element in the linked list.
  * 
- * @return linkedlist<A>::const_iterator& A reference to the updated const_iterator.
+ * @return linkedlist<A, Allocator>::const_iterator& A reference to the updated const_iterator.
  */
-template <typename A>
-constexpr const typename linkedlist<A>::const_iterator &linkedlist<A>::const_iterator::operator++()
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator &linkedlist<A, Allocator>::const_iterator::operator++()
 {
-    this->ptr = this->ptr->next;
+    if (this->list != nullptr)
+    {
+        this->ptr = this->list->state->head;
+        this->list = nullptr;
+    }
+    else
+        this->ptr = this->ptr->next;
     
     return *this;
 }
@@ -44,14 +68,15 @@ constexpr const typename linkedlist<A>::const_iterator &linkedlist<A>::const_ite
  * Advances the const_iterator to the next element in the linked list.
  * 
  * @param int Dummy parameter to distinguish from the prefix increment.
- * @return linkedlist<A>::const_iterator& A reference to the const_iterator before incrementing.
+ * @return linkedlist<A, Allocator>::const_iterator A copy of the const_iterator before incrementing.
  */
-template <typename A>
-constexpr const typename linkedlist<A>::const_iterator &linkedlist<A>::const_iterator::operator++(int)
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::const_iterator::operator++(int)
 {
-    this->ptr = this->ptr->next;
+    typename linkedlist<A, Allocator>::const_iterator it = *this;
+    ++(*this);
 
-    return *this;
+    return it;
 }
 
 /**
@@ -61,12 +86,23 @@ constexpr const typename linkedlist<A>::const_iterator &linkedlist<A>::const_ite
  * 
  * @return A The value of type A that the const_iterator points to.
  */
-template <typename A>
-constexpr const A &linkedlist<A>::const_iterator::operator*() const
+template <typename A, typename Allocator>
+const A &linkedlist<A, Allocator>::const_iterator::operator*() const
 {
     return this->ptr->value;
 }
 
+/**
+ * @brief Member access operator for the const_iterator.
+ * 
+ * @return A pointer to the value the const_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A *linkedlist<A, Allocator>::const_iterator::operator->() const
+{
+    return &this->ptr->value;
+}
+
 /**
  * @brief Equality operator for the const_iterator.
  * 
@@ -75,10 +111,10 @@ constexpr const A &linkedlist<A>::const_iterator::operator*() const
  * @param it The const_iterator to compare against.
  * @return true If both const_iterators point to the same node, false otherwise
  */
-template <typename A>
-constexpr bool linkedlist<A>::const_iterator::operator==(const typename linkedlist<A>::const_iterator &it) const
+template <typename A, typename Allocator>
+bool linkedlist<A, Allocator>::const_iterator::operator==(const typename linkedlist<A, Allocator>::const_iterator &it) const
 {
-    return this->ptr == it.ptr;
+    return this->ptr == it.ptr && this->list == it.list;
 }
 
 /**
@@ -89,54 +125,399 @@ constexpr bool linkedlist<A>::const_iterator::operator==(const typename linkedli
  * @param it The const_iterator to compare against.
  * @return true If both const_iterators point to different nodes, false otherwise
  */
-template <typename A>
-constexpr bool linkedlist<A>::const_iterator::operator!=(const typename linkedlist<A>::const_iterator &it) const
+template <typename A, typename Allocator>
+bool linkedlist<A, Allocator>::const_iterator::operator!=(const typename linkedlist<A, Allocator>::const_iterator &it) const
 {
-    return this->ptr != it.ptr;
+    return !(*this == it);
 }
 
 /**
  * @brief Constructor for the iterator.
  * 
  * Initializes the iterator with the pointer to nullptr.
- * 
- * @param ptr A pointer to the node the iterator will point to.
  */
-template <typename A>
-linkedlist<A>::iterator::iterator():
-    ptr(nullptr) {}
+template <typename A, typename Allocator>
+linkedlist<A, Allocator>::iterator::iterator():
+    ptr(nullptr), list(nullptr) {}
 
 /**
  * @brief Constructor for the iterator.
  * 
  * Initializes the iterator with the pointer to a node in the linked list.
+ * A null node together with a list is the position before the first element.
  * 
  * @param ptr A pointer to the node the iterator will point to.
+ * @param list The list whose head follows the position, for before_begin().
  */
-template <typename A>
-linkedlist<A>::iterator::iterator(typename linkedlist<A>::node *ptr):
-    ptr(ptr) {}
+template <typename A, typename Allocator>
+linkedlist<A, Allocator>::iterator::iterator(typename linkedlist<A, Allocator>::node *ptr, const linkedlist<A, Allocator> *list):
+    ptr(ptr), list(list) {}
 
 /**
- * @brief Default constructor for the linkedlist class.
+ * @brief Constructor for the linkedlist class.
  * 
  * Initializes an empty linked list with both head and tail pointers set to nullptr.
+ * The head, tail and length are kept inside the object, so no memory is allocated
+ * until a value is added or the list is shared.
+ * 
+ * @param alloc The allocator used for the nodes and bookkeeping of the list.
+ */
+template <typename A, typename Allocator>
+linkedlist<A, Allocator>::linkedlist(const Allocator &alloc):
+    alloc(alloc), inline_state(), state(&this->inline_state)
+{
+    this->inline_state.ref_count = 1;
+}
+
+/**
+ * @brief Allocates and value-initializes one object through the list's allocator.
+ * 
+ * The allocator is rebound to `T`, so nodes and control blocks come from the
+ * same resource as the list itself.
+ * 
+ * @tparam T The type of the object to be allocated.
+ * @return A pointer to the new object.
+ */
+template <typename A, typename Allocator>
+template <typename T>
+T *linkedlist<A, Allocator>::allocate() const
+{
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<T> rebound_allocator;
+    typedef std::allocator_traits<rebound_allocator> rebound_traits;
+
+    rebound_allocator alloc(this->alloc);
+    T *ptr = rebound_traits::allocate(alloc, 1);
+    try
+    {
+        rebound_traits::construct(alloc, ptr);
+    }
+    catch (...)
+    {
+        rebound_traits::deallocate(alloc, ptr, 1);
+        throw;
+    }
+
+    return ptr;
+}
+
+/**
+ * @brief Destroys and frees one object obtained from allocate().
+ * 
+ * @tparam T The type the object was allocated as.
+ * @param ptr A pointer to the object, nullptr is ignored.
+ */
+template <typename A, typename Allocator>
+template <typename T>
+void linkedlist<A, Allocator>::deallocate(T *ptr) const
+{
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<T> rebound_allocator;
+    typedef std::allocator_traits<rebound_allocator> rebound_traits;
+
+    if (ptr == nullptr)
+        return;
+
+    rebound_allocator alloc(this->alloc);
+    rebound_traits::destroy(alloc, ptr);
+    rebound_traits::deallocate(alloc, ptr, 1);
+}
+
+/**
+ * @brief Makes this list refer to the nodes of another list.
+ * 
+ * An unshared `obj` first moves its head, tail and length out of the object
+ * into a control block from its allocator, which then counts the lists sharing
+ * it. Must only be called on a list without state of its own, that is from a
+ * constructor or after release().
+ * 
+ * @param obj The list to share the nodes of.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::share(const linkedlist<A, Allocator> &obj)
+{
+    if (obj.state == &obj.inline_state)
+    {
+        obj.state = obj.template allocate<typename linkedlist<A, Allocator>::control>();
+        *obj.state = obj.inline_state;
+    }
+
+    this->state = obj.state;
+    this->state->ref_count++;
+}
+
+/**
+ * @brief Takes over the nodes of another list, leaving it empty.
+ * 
+ * Must only be called on a list without state of its own, that is from a
+ * constructor or after release().
+ * 
+ * @param obj The list to take the nodes from.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::take(linkedlist<A, Allocator> &obj)
+{
+    if (obj.state == &obj.inline_state)
+    {
+        this->inline_state = obj.inline_state;
+        this->state = &this->inline_state;
+    }
+    else
+        this->state = obj.state;
+
+    obj.reset();
+}
+
+/**
+ * @brief Drops this list's reference to its nodes.
+ * 
+ * The nodes, and the control block of a shared list, are returned to the
+ * allocator once no other list refers to them. The list has to be given new
+ * state with reset(), share() or take() before it is used again.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::release()
+{
+    if (this->state == &this->inline_state)
+    {
+        this->clear();
+        this->deallocate(this->state->extra);
+        this->state->extra = nullptr;
+        return;
+    }
+
+    this->state->ref_count--;
+    if (this->state->ref_count == 0)
+    {
+        this->clear();
+        this->deallocate(this->state->extra);
+        this->deallocate(this->state);
+    }
+}
+
+/**
+ * @brief Makes this list an empty, unshared list.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::reset()
+{
+    this->inline_state.head = this->inline_state.tail = nullptr;
+    this->inline_state.length = 0;
+    this->inline_state.ref_count = 1;
+    this->inline_state.extra = nullptr;
+    this->state = &this->inline_state;
+}
+
+/**
+ * @brief Returns the bookkeeping of opt-in features, allocating it on first use.
+ * 
+ * Slabs, the cached digest and the known order are only needed by lists that
+ * use compact(), hash() or order tracking, so the control block keeps them
+ * behind a pointer and a plain list pays one null pointer for them. They are
+ * shared, and freed, together with the control block.
+ * 
+ * @return The bookkeeping, with no slabs, no valid digest and no known order when new.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::extension &linkedlist<A, Allocator>::extras() const
+{
+    if (this->state->extra == nullptr)
+        this->state->extra = this->template allocate<typename linkedlist<A, Allocator>::extension>();
+
+    return *this->state->extra;
+}
+
+/**
+ * @brief Drops the cached digest and the known order, since values may be written.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::forget_order() const
+{
+    if (this->state->extra == nullptr)
+        return;
+
+    this->state->extra->digest_valid = false;
+    this->state->extra->ascending = this->state->extra->descending = false;
+}
+
+/**
+ * @brief Hashes one value for the list digest.
+ * 
+ * Mixes `std::hash<A>` so that small and zero hashes still spread over all
+ * bits. Types without `std::hash` map to 0; the public hashing members reject
+ * them at compile time.
+ * 
+ * @param value The value to hash.
+ * @return The term the value contributes to the digest.
+ */
+template <typename A, typename Allocator>
+size_t linkedlist<A, Allocator>::digest_term(const A &value)
+{
+    return linkedlist<A, Allocator>::digest_term(value, std::integral_constant<bool, linkedlist<A, Allocator>::template hashable<A>(0)>());
+}
+
+template <typename A, typename Allocator>
+size_t linkedlist<A, Allocator>::digest_term(const A &value, std::true_type)
+{
+    size_t term = (std::hash<A>()(value) + (size_t)0x9e3779b97f4a7c15UL) * (size_t)0xbf58476d1ce4e5b9UL;
+
+    return term ^ (term >> 31);
+}
+
+template <typename A, typename Allocator>
+size_t linkedlist<A, Allocator>::digest_term(const A &, std::false_type)
+{
+    return 0;
+}
+
+/**
+ * @brief Returns the digest of the list, recomputing it if it is stale.
+ * 
+ * The digest is cached in the control block, so lists sharing their nodes
+ * share it too. Mutators either update it in O(1) or mark it stale.
+ * 
+ * @return The order-sensitive digest of the values.
+ */
+template <typename A, typename Allocator>
+size_t linkedlist<A, Allocator>::digest() const
+{
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
+    if (!extra.digest_valid)
+    {
+        size_t digest = 0, power = 1;
+        for (const node *ptr = this->state->head; ptr != nullptr; ptr = ptr->next)
+        {
+            digest = digest * linkedlist<A, Allocator>::digest_base + linkedlist<A, Allocator>::digest_term(ptr->value);
+            power *= linkedlist<A, Allocator>::digest_base;
+        }
+
+        extra.digest = digest;
+        extra.digest_power = power;
+        extra.digest_valid = true;
+    }
+
+    return extra.digest;
+}
+
+/**
+ * @brief Checks whether the list keeps its digest up to date as it changes.
+ * 
+ * @return false unless a derived list opts in to hash tracking.
+ */
+template <typename A, typename Allocator>
+bool linkedlist<A, Allocator>::tracks_hash() const
+{
+    return false;
+}
+
+/**
+ * @brief Checks whether the cached digests prove two lists different.
+ * 
+ * Nothing is computed: a stale digest on either side proves nothing. Only
+ * lists that both track their hash are trusted, since a digest cached by a
+ * plain hash() call misses values written through an earlier reference.
+ * 
+ * @param obj The list to compare with.
+ * @return true if both lists track their hash, and both digests are up to date and differ.
+ */
+template <typename A, typename Allocator>
+bool linkedlist<A, Allocator>::digest_differs(const linkedlist<A, Allocator> &obj) const
+{
+    const typename linkedlist<A, Allocator>::extension *mine = this->state->extra, *theirs = obj.state->extra;
+
+    if (!this->tracks_hash() || !obj.tracks_hash())
+        return false;
+
+    return mine != nullptr && theirs != nullptr && mine->digest_valid && theirs->digest_valid && mine->digest != theirs->digest;
+}
+
+/**
+ * @brief Converts a slice bound to a position within a list.
+ * 
+ * Negative bounds count from the end, and bounds past either end are clamped
+ * to it, as in Python slicing.
+ * 
+ * @param index The bound, may be negative.
+ * @param length The length of the list.
+ * @return The position, between 0 and `length`.
+ */
+template <typename A, typename Allocator>
+size_t linkedlist<A, Allocator>::bound(const int64_t &index, const size_t &length)
+{
+    if (index < 0L)
+        return (index + (int64_t)length < 0L) ? 0 : (size_t)(index + (int64_t)length);
+
+    return ((size_t)index > length) ? length : (size_t)index;
+}
+
+/**
+ * @brief Converts the start of a range to a position within the list.
+ * 
+ * @param index The start, negative values count from the end. The end of the
+ *              list itself is a valid start for an empty range.
+ * @return The position, between 0 and `size()`.
+ * @throws INDEX_ERROR If the index is outside the list.
+ */
+template <typename A, typename Allocator>
+size_t linkedlist<A, Allocator>::offset(const int64_t &index) const
+{
+    if (index < -(int64_t)(this->state->length) || index > (int64_t)(this->state->length))
+        throw INDEX_ERROR("Pop index out of range");
+
+    return (index < 0L) ? (size_t)(index + (int64_t)(this->state->length)) : (size_t)index;
+}
+
+/**
+ * @brief Copies an allocator on copy assignment when it propagates.
+ * 
+ * @param to The allocator to be replaced.
+ * @param from The allocator to be copied.
  */
-template <typename A>
-linkedlist<A>::linkedlist():
-    head(new linkedlist<A>::node*(nullptr)), tail(new linkedlist<A>::node*(nullptr)) {}
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::propagate_copy(Allocator &to, const Allocator &from, std::true_type)
+{
+    to = from;
+}
+
+/**
+ * @brief Keeps the allocator on copy assignment when it does not propagate.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::propagate_copy(Allocator &, const Allocator &, std::false_type) {}
+
+/**
+ * @brief Moves an allocator on move assignment when it propagates.
+ * 
+ * @param to The allocator to be replaced.
+ * @param from The allocator to be moved.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::propagate_move(Allocator &to, Allocator &from, std::true_type)
+{
+    to = std::move(from);
+}
+
+/**
+ * @brief Keeps the allocator on move assignment when it does not propagate.
+ */
+template <typename A, typename Allocator>
+void linkedlist<A, Allocator>::propagate_move(Allocator &, Allocator &, std::false_type) {}
 
 /**
  * @brief Prefix increment operator for the iterator.
  * 
  * Advances the iterator to the next element in the linked list.
  * 
- * @return linkedlist<A>::iterator& A reference to the updated iterator.
+ * @return linkedlist<A, Allocator>::iterator& A reference to the updated iterator.
  */
-template <typename A>
-constexpr typename linkedlist<A>::iterator &linkedlist<A>::iterator::operator++()
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator &linkedlist<A, Allocator>::iterator::operator++()
 {
-    this->ptr = this->ptr->next;
+    if (this->list != nullptr)
+    {
+        this->ptr = this->list->state->head;
+        this->list = nullptr;
+    }
+    else
+        this->ptr = this->ptr->next;
     
     return *this;
 }
@@ -147,14 +528,15 @@ constexpr typename linkedlist<A>::iterator &linkedlist<A>::iterator::operator++(
  * Advances the iterator to the next element in the linked list.
  * 
  * @param int Dummy parameter to distinguish from the prefix increment.
- * @return linkedlist<A>::iterator& A reference to the iterator before incrementing.
+ * @return linkedlist<A, Allocator>::iterator A copy of the iterator before incrementing.
  */
-template <typename A>
-constexpr typename linkedlist<A>::iterator &linkedlist<A>::iterator::operator++(int)
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator linkedlist<A, Allocator>::iterator::operator++(int)
 {
-    this->ptr = this->ptr->next;
+    typename linkedlist<A, Allocator>::iterator it = *this;
+    ++(*this);
 
-    return *this;
+    return it;
 }
 
 /**
@@ -164,12 +546,23 @@ constexpr typename linkedlist<A>::iterator &linkedlist<A>::iterator::operator++(
  * 
  * @return A The value of type A that the iterator points to.
  */
-template <typename A>
-constexpr A &linkedlist<A>::iterator::operator*()
+template <typename A, typename Allocator>
+A &linkedlist<A, Allocator>::iterator::operator*() const
 {
     return this->ptr->value;
 }
 
+/**
+ * @brief Member access operator for the iterator.
+ * 
+ * @return A pointer to the value the iterator points to.
+ */
+template <typename A, typename Allocator>
+A *linkedlist<A, Allocator>::iterator::operator->() const
+{
+    return &this->ptr->value;
+}
+
 /**
  * @brief Equality operator for the iterator.
  * 
@@ -178,10 +571,10 @@ constexpr A &linkedlist<A>::iterator::operator*()
  * @param it The iterator to compare against.
  * @return true If both iterators point to the same node, false otherwise
  */
-template <typename A>
-constexpr bool linkedlist<A>::iterator::operator==(const typename linkedlist<A>::iterator &it) const
+template <typename A, typename Allocator>
+bool linkedlist<A, Allocator>::iterator::operator==(const typename linkedlist<A, Allocator>::iterator &it) const
 {
-    return this->ptr == it.ptr;
+    return this->ptr == it.ptr && this->list == it.list;
 }
 
 /**
@@ -192,10 +585,67 @@ constexpr bool linkedlist<A>::iterator::operator==(const typename linkedlist<A>:
  * @param it The iterator to compare against.
  * @return true If both iterators point to different nodes, false otherwise
  */
-template <typename A>
-constexpr bool linkedlist<A>::iterator::operator!=(const typename linkedlist<A>::iterator &it) const
+template <typename A, typename Allocator>
+bool linkedlist<A, Allocator>::iterator::operator!=(const typename linkedlist<A, Allocator>::iterator &it) const
 {
-    return this->ptr != it.ptr;
+    return !(*this == it);
+}
+
+/**
+ * @brief Wraps a node of a derived list in an iterator.
+ * 
+ * @param ptr The node, or nullptr for the end of the list.
+ * @return An iterator pointing to the node.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator linkedlist<A, Allocator>::wrap(typename linkedlist<A, Allocator>::node *ptr)
+{
+    return linkedlist<A, Allocator>::iterator(ptr);
+}
+
+/**
+ * @brief Gets a mutable iterator at the position of a const_iterator.
+ * 
+ * @param pos The const_iterator, which must point into a list the caller may modify.
+ * @return An iterator at the same position.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator linkedlist<A, Allocator>::wrap(const typename linkedlist<A, Allocator>::const_iterator &pos)
+{
+    return linkedlist<A, Allocator>::iterator(const_cast<typename linkedlist<A, Allocator>::node *>(pos.ptr), pos.list);
+}
+
+/**
+ * @brief Gets the node an iterator points to.
+ * 
+ * @param pos The iterator.
+ * @return The node, or nullptr for before_begin() and end().
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::node *linkedlist<A, Allocator>::unwrap(const typename linkedlist<A, Allocator>::const_iterator &pos)
+{
+    return const_cast<typename linkedlist<A, Allocator>::node *>(pos.ptr);
+}
+
+/**
+ * @brief Gets the link that holds the node after an iterator.
+ * 
+ * This is the list's head pointer for before_begin() and the node's next
+ * pointer otherwise, so a node can be linked in or out after `pos` in O(1).
+ * 
+ * @param pos The iterator.
+ * @return The link, or nullptr for end().
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::node **linkedlist<A, Allocator>::getlink(const typename linkedlist<A, Allocator>::const_iterator &pos)
+{
+    if (pos.list != nullptr)
+        return &pos.list->state->head;
+
+    if (pos.ptr == nullptr)
+        return nullptr;
+
+    return &const_cast<typename linkedlist<A, Allocator>::node *>(pos.ptr)->next;
 }
 
 /**
@@ -206,10 +656,10 @@ constexpr bool linkedlist<A>::iterator::operator!=(const typename linkedlist<A>:
  * @param obj The linked list whose head node is to be retrieved.
  * @return A pointer to the head node of the linked list.
  */
-template <typename A>
-constexpr typename linkedlist<A>::node **linkedlist<A>::gethead(const linkedlist<A> &obj) 
+template <typename A, typename Allocator>
+constexpr typename linkedlist<A, Allocator>::node **linkedlist<A, Allocator>::gethead(const linkedlist<A, Allocator> &obj) 
 {
-    return obj.head;
+    return &obj.state->head;
 }
 
 /**
@@ -222,8 +672,8 @@ constexpr typename linkedlist<A>::node **linkedlist<A>::gethead(const linkedlist
  * @param head The head node of the linked list to find the middle of.
  * @return A pointer to the middle node of the linked list.
  */
-template <typename A>
-constexpr typename linkedlist<A>::node *linkedlist<A>::getmiddle(linkedlist<A>::node *head) 
+template <typename A, typename Allocator>
+constexpr typename linkedlist<A, Allocator>::node *linkedlist<A, Allocator>::getmiddle(linkedlist<A, Allocator>::node *head) 
 {
     if (head == nullptr)
         return head;
@@ -246,23 +696,24 @@ constexpr typename linkedlist<A>::node *linkedlist<A>::getmiddle(linkedlist<A>::
  * @param obj The linked list whose tail node is to be retrieved.
  * @return A pointer to the tail node of the linked list.
  */
-template <typename A>
-constexpr typename linkedlist<A>::node **linkedlist<A>::gettail(const linkedlist<A> &obj) 
+template <typename A, typename Allocator>
+constexpr typename linkedlist<A, Allocator>::node **linkedlist<A, Allocator>::gettail(const linkedlist<A, Allocator> &obj) 
 {
-    return obj.tail;
+    return &obj.state->tail;
 }
 
 /**
  * @brief Returns the number of elements in the linked list.
  * 
- * This method computes the size of the linked list by calling the len function.
+ * The length is kept up to date by every operation, so this is constant time and,
+ * being non-virtual, can be inlined even through a `linkedlist` reference.
  * 
  * @return The number of elements in the linked list.
  */
-template <typename A>
-constexpr size_t linkedlist<A>::size() const
+template <typename A, typename Allocator>
+constexpr size_t linkedlist<A, Allocator>::size() const
 {
-    return len(*this);
+    return this->state->length;
 }
 
 /**
@@ -272,81 +723,165 @@ constexpr size_t linkedlist<A>::size() const
  * 
  * @return true if the linked list is empty, false otherwise.
  */
-template <typename A>
-constexpr bool linkedlist<A>::isempty() const
+template <typename A, typename Allocator>
+constexpr bool linkedlist<A, Allocator>::isempty() const
 {
-    return (*this->head == nullptr);
+    return (this->state->head == nullptr);
 }
 
 /**
- * @brief Get an const_iterator to the beginning of the linked list.
+ * @brief Get the allocator of the linked list.
  * 
- * This function returns an const_iterator pointing to the first element in the linked list.
+ * @return A copy of the allocator the list was constructed with.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::allocator_type linkedlist<A, Allocator>::get_allocator() const
+{
+    return this->alloc;
+}
+
+/**
+ * @brief Get an iterator to the beginning of the linked list.
  * 
- * @return linkedlist<A>::const_iterator An const_iterator to the beginning of the list.
+ * This function returns an iterator pointing to the first element in the linked list.
+ * 
+ * @return linkedlist<A, Allocator>::iterator An iterator to the beginning of the list.
  */
-template <typename A>
-constexpr typename linkedlist<A>::iterator linkedlist<A>::begin()
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator linkedlist<A, Allocator>::begin()
 {
-    return linkedlist<A>::iterator(*this->head);
+    // Values may be written through the iterator
+    this->forget_order();
+
+    return linkedlist<A, Allocator>::iterator(this->state->head);
 }
 
 /**
- * @brief Get an const_iterator to the end of the linked list.
+ * @brief Get an iterator to the end of the linked list.
  * 
- * This function returns an const_iterator pointing to the end (one past the last element) of the linked list.
+ * This function returns an iterator pointing to the end (one past the last element) of the linked list.
  * 
- * @return linkedlist<A>::const_iterator An const_iterator to the end of the list.
+ * @return linkedlist<A, Allocator>::iterator An iterator to the end of the list.
  */
-template <typename A>
-constexpr typename linkedlist<A>::iterator linkedlist<A>::end()
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator linkedlist<A, Allocator>::end()
 {
-    return linkedlist<A>::iterator(nullptr);
+    return linkedlist<A, Allocator>::iterator(nullptr);
 }
 
 /**
- * @brief Get a const const_iterator to the beginning of the linked list.
+ * @brief Get a const_iterator to the beginning of a const linked list.
  * 
- * This function returns a const const_iterator pointing to the first element in the linked list.
+ * @return linkedlist<A, Allocator>::const_iterator A const_iterator to the beginning of the list.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::begin() const
+{
+    return linkedlist<A, Allocator>::const_iterator(this->state->head);
+}
+
+/**
+ * @brief Get a const_iterator to the end of a const linked list.
  * 
- * @return const linkedlist<A>::const_iterator A const const_iterator to the beginning of the list.
+ * @return linkedlist<A, Allocator>::const_iterator A const_iterator to the end of the list.
  */
-template <typename A>
-constexpr const typename linkedlist<A>::const_iterator linkedlist<A>::cbegin() const
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::end() const
 {
-    return linkedlist<A>::const_iterator(*this->head);
+    return linkedlist<A, Allocator>::const_iterator(nullptr);
 }
 
 /**
- * @brief Get a const const_iterator to the end of the linked list.
+ * @brief Get a const_iterator to the beginning of the linked list.
  * 
- * This function returns a const const_iterator pointing to the end (one past the last element) of the linked list.
+ * This function returns a const_iterator pointing to the first element in the linked list.
  * 
- * @return const linkedlist<A>::const_iterator A const const_iterator to the end of the list.
+ * @return linkedlist<A, Allocator>::const_iterator A const_iterator to the beginning of the list.
  */
-template <typename A>
-constexpr const typename linkedlist<A>::const_iterator linkedlist<A>::cend() const
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::cbegin() const
 {
-    return linkedlist<A>::const_iterator(nullptr);
+    return linkedlist<A, Allocator>::const_iterator(this->state->head);
+}
+
+/**
+ * @brief Get a const_iterator to the end of the linked list.
+ * 
+ * This function returns a const_iterator pointing to the end (one past the last element) of the linked list.
+ * 
+ * @return linkedlist<A, Allocator>::const_iterator A const_iterator to the end of the list.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::cend() const
+{
+    return linkedlist<A, Allocator>::const_iterator(nullptr);
+}
+
+/**
+ * @brief Get an iterator to the position before the first element.
+ * 
+ * The iterator cannot be dereferenced; it is the position insert_after() and
+ * erase_after() use to work on the head of the list. Incrementing it gives
+ * begin(), read when the increment happens, so it stays valid while values
+ * are inserted or erased at the front.
+ * 
+ * @return linkedlist<A, Allocator>::iterator An iterator before the beginning of the list.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::iterator linkedlist<A, Allocator>::before_begin()
+{
+    // Values may be written through the iterator
+    this->forget_order();
+
+    return linkedlist<A, Allocator>::iterator(nullptr, this);
+}
+
+/**
+ * @brief Get a const_iterator to the position before the first element of a const linked list.
+ * 
+ * @return linkedlist<A, Allocator>::const_iterator A const_iterator before the beginning of the list.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::before_begin() const
+{
+    return linkedlist<A, Allocator>::const_iterator(nullptr, this);
+}
+
+/**
+ * @brief Get a const_iterator to the position before the first element.
+ * 
+ * @return linkedlist<A, Allocator>::const_iterator A const_iterator before the beginning of the list.
+ */
+template <typename A, typename Allocator>
+typename linkedlist<A, Allocator>::const_iterator linkedlist<A, Allocator>::cbefore_begin() const
+{
+    return linkedlist<A, Allocator>::const_iterator(nullptr, this);
 }
 
 /**
  * @brief Finds and returns the minimum value in the singly linked list.
  *
- * An exception is thrown if the list is empty.
+ * An exception is thrown if the list is empty. A singly_linked_list tracking
+ * its order (see set_order_tracking()) that is known to be in order
+ * answers from its head or tail in constant time.
  *
  * @param obj The linked list object to search for the minimum value.
  * @return The minimum value in the list.
  * @throws VALUE_ERROR If the list is empty.
  */
-template <typename A>
-A min(const linkedlist<A> &obj)
+template <typename A, typename Allocator>
+A min(const linkedlist<A, Allocator> &obj)
 {
     if (obj.isempty())
         throw VALUE_ERROR("Finding min in Empty List");
 
-    A min_value = (*obj.head)->value;
-    typename linkedlist<A>::node *ptr = (*obj.head)->next;
+    if (obj.state->extra != nullptr && obj.state->extra->ascending)
+        return (obj.state->head)->value;
+    if (obj.state->extra != nullptr && obj.state->extra->descending)
+        return (obj.state->tail)->value;
+
+    A min_value = (obj.state->head)->value;
+    typename linkedlist<A, Allocator>::node *ptr = (obj.state->head)->next;
     while (ptr != nullptr)
     {
         if (ptr->value < min_value)
@@ -360,20 +895,27 @@ A min(const linkedlist<A> &obj)
 /**
  * @brief Finds and returns the maximum value in the singly linked list.
  *
- * An exception is thrown if the list is empty.
+ * An exception is thrown if the list is empty. A singly_linked_list tracking
+ * its order (see set_order_tracking()) that is known to be in order
+ * answers from its head or tail in constant time.
  *
  * @param obj The linked list object to search for the maximum value.
  * @return The maximum value in the list.
  * @throws VALUE_ERROR If the list is empty.
  */
-template <typename A>
-A max(const linkedlist<A> &obj)
+template <typename A, typename Allocator>
+A max(const linkedlist<A, Allocator> &obj)
 {
     if (obj.isempty())
         throw VALUE_ERROR("Finding max in Empty List");
 
-    A max_value = (*obj.head)->value;
-    typename linkedlist<A>::node *ptr = (*obj.head)->next;
+    if (obj.state->extra != nullptr && obj.state->extra->ascending)
+        return (obj.state->tail)->value;
+    if (obj.state->extra != nullptr && obj.state->extra->descending)
+        return (obj.state->head)->value;
+
+    A max_value = (obj.state->head)->value;
+    typename linkedlist<A, Allocator>::node *ptr = (obj.state->head)->next;
     while (ptr != nullptr)
     {
         if (ptr->value > max_value)
@@ -392,17 +934,20 @@ A max(const linkedlist<A> &obj)
  * @param obj The linked list whose length is to be calculated.
  * @return The number of nodes in the linked list.
  */
-template <typename A>
-size_t len(const linkedlist<A> &obj)
+template <typename A, typename Allocator>
+size_t len(const linkedlist<A, Allocator> &obj)
 {
+    LINKEDLIST_STAT_SCOPE(list_op::len);
+
     size_t size = 0; ///< Variable to keep track of the number of nodes
-    typename linkedlist<A>::node *ptr = *obj.head; ///< Pointer to traverse the linked list
+    typename linkedlist<A, Allocator>::node *ptr = obj.state->head; ///< Pointer to traverse the linked list
 
     // Traverse the linked list and count nodes
     while (ptr != nullptr)
     {
         size++;
         ptr = ptr->next;
+        LINKEDLIST_STAT_HOP();
     }
 
     return size;
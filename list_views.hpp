@@ -0,0 +1,301 @@
+#if __cplusplus >= 201103L
+
+#ifndef LIST_VIEWS_H
+#define LIST_VIEWS_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+    #if __has_include(<coroutine>)
+        #include <coroutine>
+        #include <exception>
+        #define LINKEDLIST_GENERATOR
+    #endif
+#endif
+
+/**
+ * @brief Iterator that applies a function to each value of another iterator.
+ *
+ * @tparam Iterator The underlying iterator.
+ * @tparam Function Called with each underlying value; its result is the value.
+ */
+template <typename Iterator, typename Function>
+class map_iterator
+{
+    private:
+        Iterator current;
+        mutable Function func;
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef decltype(std::declval<Function &>()(*std::declval<Iterator &>())) reference;
+        typedef typename std::decay<reference>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+
+        map_iterator(Iterator current, Function func);
+
+        map_iterator &operator++();
+        map_iterator operator++(int);
+        reference operator*() const;
+        bool operator==(const map_iterator &it) const;
+        bool operator!=(const map_iterator &it) const;
+};
+
+/**
+ * @brief Iterator that skips the values of another iterator failing a predicate.
+ *
+ * @tparam Iterator The underlying iterator.
+ * @tparam Predicate Called with each underlying value; values it rejects are skipped.
+ */
+template <typename Iterator, typename Predicate>
+class filter_iterator
+{
+    private:
+        Iterator current, last;
+        mutable Predicate pred;
+
+        void skip();
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+        typedef typename std::iterator_traits<Iterator>::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+
+        filter_iterator(Iterator current, Iterator last, Predicate pred);
+
+        filter_iterator &operator++();
+        filter_iterator operator++(int);
+        reference operator*() const;
+        bool operator==(const filter_iterator &it) const;
+        bool operator!=(const filter_iterator &it) const;
+};
+
+/**
+ * @brief Iterator over at most a given number of values of another iterator.
+ *
+ * The underlying iterator is not advanced past the last value taken, so taking
+ * from an endless generator stops pulling values once the count is reached.
+ *
+ * @tparam Iterator The underlying iterator.
+ */
+template <typename Iterator>
+class take_iterator
+{
+    private:
+        Iterator current;
+        size_t remaining;
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+        typedef typename std::iterator_traits<Iterator>::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+
+        take_iterator(Iterator current, const size_t &remaining);
+
+        take_iterator &operator++();
+        take_iterator operator++(int);
+        reference operator*() const;
+        bool operator==(const take_iterator &it) const;
+        bool operator!=(const take_iterator &it) const;
+};
+
+/**
+ * @brief Iterator over pairs of values from two iterators in step.
+ *
+ * It reaches the end as soon as either iterator does.
+ *
+ * @tparam Left The iterator giving the first value of each pair.
+ * @tparam Right The iterator giving the second value of each pair.
+ */
+template <typename Left, typename Right>
+class zip_iterator
+{
+    private:
+        Left left;
+        Right right;
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef std::pair<typename std::iterator_traits<Left>::reference, typename std::iterator_traits<Right>::reference> reference;
+        typedef std::pair<typename std::iterator_traits<Left>::value_type, typename std::iterator_traits<Right>::value_type> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+
+        zip_iterator(Left left, Right right);
+
+        zip_iterator &operator++();
+        zip_iterator operator++(int);
+        reference operator*() const;
+        bool operator==(const zip_iterator &it) const;
+        bool operator!=(const zip_iterator &it) const;
+};
+
+/**
+ * @brief Iterator over pairs of a position and a value of another iterator.
+ *
+ * @tparam Iterator The underlying iterator.
+ */
+template <typename Iterator>
+class enumerate_iterator
+{
+    private:
+        Iterator current;
+        size_t index;
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef std::pair<size_t, typename std::iterator_traits<Iterator>::reference> reference;
+        typedef std::pair<size_t, typename std::iterator_traits<Iterator>::value_type> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+
+        enumerate_iterator(Iterator current, const size_t &index);
+
+        enumerate_iterator &operator++();
+        enumerate_iterator operator++(int);
+        reference operator*() const;
+        bool operator==(const enumerate_iterator &it) const;
+        bool operator!=(const enumerate_iterator &it) const;
+};
+
+/**
+ * @brief A lazy, single-pass view over a range of a list.
+ *
+ * A view holds two iterators and no values. The adaptors return a new view
+ * whose iterator wraps the old one, so a chain such as
+ * `view(list).filter(p).map(f).take(n)` allocates nothing and reads the list
+ * once, when the view is iterated or collected. A view must not outlive the
+ * list it reads, and the list must not be changed while the view is in use.
+ *
+ * @tparam Iterator The iterator the view walks.
+ */
+template <typename Iterator>
+class list_view
+{
+    private:
+        Iterator first, last;
+    public:
+        typedef Iterator iterator;
+        typedef Iterator const_iterator;
+        typedef typename std::iterator_traits<Iterator>::value_type value_type;
+        typedef typename std::iterator_traits<Iterator>::reference reference;
+
+        list_view(Iterator first, Iterator last);
+
+        iterator begin() const;
+        iterator end() const;
+
+        template <typename Function>
+        list_view<map_iterator<Iterator, Function>> map(Function func) const;
+
+        template <typename Predicate>
+        list_view<filter_iterator<Iterator, Predicate>> filter(Predicate pred) const;
+
+        list_view<take_iterator<Iterator>> take(const size_t &count) const;
+        list_view<Iterator> drop(const size_t &count) const;
+
+        template <typename Other>
+        list_view<zip_iterator<Iterator, Other>> zip(const list_view<Other> &other) const;
+
+        list_view<enumerate_iterator<Iterator>> enumerate() const;
+
+        template <typename List>
+        List collect() const;
+
+        template <typename List>
+        void collect(List &list) const;
+};
+
+template <typename Range>
+auto view(Range &range) -> list_view<decltype(range.begin())>;
+
+#ifdef LINKEDLIST_GENERATOR
+
+/**
+ * @brief A C++20 coroutine that produces values one at a time.
+ *
+ * A function returning `generator<A>` runs until its next `co_yield` each time
+ * its iterator is advanced, so a list can be filled from it with
+ * `append_range(gen.begin(), gen.end())`, or through `view(gen)`, without
+ * staging the values anywhere first. A generator can be iterated once.
+ * An exception thrown by the coroutine is rethrown from the iterator.
+ *
+ * @tparam A The type of the values produced.
+ */
+template <typename A>
+class generator
+{
+    public:
+        class promise_type
+        {
+            private:
+                const A *current;
+                std::exception_ptr exception;
+
+                friend class generator<A>;
+            public:
+                generator<A> get_return_object();
+                std::suspend_always initial_suspend() const noexcept;
+                std::suspend_always final_suspend() const noexcept;
+                std::suspend_always yield_value(const A &value) noexcept;
+                void return_void() const noexcept;
+                void unhandled_exception();
+        };
+
+        class iterator
+        {
+            private:
+                std::coroutine_handle<promise_type> handle;
+
+                explicit iterator(std::coroutine_handle<promise_type> handle);
+                bool exhausted() const;
+
+                friend class generator<A>;
+            public:
+                typedef std::input_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const A *pointer;
+                typedef const A &reference;
+
+                iterator();
+
+                iterator &operator++();
+                void operator++(int);
+                const A &operator*() const;
+                const A *operator->() const;
+                bool operator==(const iterator &it) const;
+                bool operator!=(const iterator &it) const;
+        };
+
+        typedef A value_type;
+
+        generator(generator<A> &&obj) noexcept;
+        generator(const generator<A> &obj) = delete;
+
+        generator<A> &operator=(generator<A> &&obj) noexcept;
+        generator<A> &operator=(const generator<A> &obj) = delete;
+
+        iterator begin();
+        iterator end();
+
+        ~generator();
+    private:
+        std::coroutine_handle<promise_type> handle;
+
+        explicit generator(std::coroutine_handle<promise_type> handle);
+};
+
+#endif
+
+#include "./list_views.tpp"
+
+#endif
+
+#else
+    #error "Requires C++11 or later.\n"
+
+#endif
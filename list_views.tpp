@@ -0,0 +1,797 @@
+#include "./list_views.hpp"
+
+
+/**
+ * @brief Constructor for the map_iterator.
+ *
+ * @param current The underlying iterator.
+ * @param func The function applied to each value.
+ */
+template <typename Iterator, typename Function>
+map_iterator<Iterator, Function>::map_iterator(Iterator current, Function func):
+    current(current), func(func) {}
+
+/**
+ * @brief Prefix increment operator for the map_iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename Iterator, typename Function>
+map_iterator<Iterator, Function> &map_iterator<Iterator, Function>::operator++()
+{
+    ++this->current;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the map_iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename Iterator, typename Function>
+map_iterator<Iterator, Function> map_iterator<Iterator, Function>::operator++(int)
+{
+    map_iterator<Iterator, Function> it = *this;
+    ++this->current;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the map_iterator.
+ *
+ * The function is called on every dereference; nothing is cached.
+ *
+ * @return The function applied to the underlying value.
+ */
+template <typename Iterator, typename Function>
+typename map_iterator<Iterator, Function>::reference map_iterator<Iterator, Function>::operator*() const
+{
+    return this->func(*this->current);
+}
+
+/**
+ * @brief Equality operator for the map_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both underlying iterators are equal, false otherwise.
+ */
+template <typename Iterator, typename Function>
+bool map_iterator<Iterator, Function>::operator==(const map_iterator<Iterator, Function> &it) const
+{
+    return this->current == it.current;
+}
+
+/**
+ * @brief Inequality operator for the map_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the underlying iterators differ, false otherwise.
+ */
+template <typename Iterator, typename Function>
+bool map_iterator<Iterator, Function>::operator!=(const map_iterator<Iterator, Function> &it) const
+{
+    return !(*this == it);
+}
+
+/**
+ * @brief Constructor for the filter_iterator.
+ *
+ * Moves to the first value accepted by the predicate.
+ *
+ * @param current The underlying iterator.
+ * @param last The end of the underlying range.
+ * @param pred The predicate values must satisfy.
+ */
+template <typename Iterator, typename Predicate>
+filter_iterator<Iterator, Predicate>::filter_iterator(Iterator current, Iterator last, Predicate pred):
+    current(current), last(last), pred(pred)
+{
+    this->skip();
+}
+
+/**
+ * @brief Advances the underlying iterator to the next accepted value or the end.
+ */
+template <typename Iterator, typename Predicate>
+void filter_iterator<Iterator, Predicate>::skip()
+{
+    while (this->current != this->last && !this->pred(*this->current))
+        ++this->current;
+}
+
+/**
+ * @brief Prefix increment operator for the filter_iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename Iterator, typename Predicate>
+filter_iterator<Iterator, Predicate> &filter_iterator<Iterator, Predicate>::operator++()
+{
+    ++this->current;
+    this->skip();
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the filter_iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename Iterator, typename Predicate>
+filter_iterator<Iterator, Predicate> filter_iterator<Iterator, Predicate>::operator++(int)
+{
+    filter_iterator<Iterator, Predicate> it = *this;
+    ++*this;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the filter_iterator.
+ *
+ * @return The underlying value.
+ */
+template <typename Iterator, typename Predicate>
+typename filter_iterator<Iterator, Predicate>::reference filter_iterator<Iterator, Predicate>::operator*() const
+{
+    return *this->current;
+}
+
+/**
+ * @brief Equality operator for the filter_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both underlying iterators are equal, false otherwise.
+ */
+template <typename Iterator, typename Predicate>
+bool filter_iterator<Iterator, Predicate>::operator==(const filter_iterator<Iterator, Predicate> &it) const
+{
+    return this->current == it.current;
+}
+
+/**
+ * @brief Inequality operator for the filter_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the underlying iterators differ, false otherwise.
+ */
+template <typename Iterator, typename Predicate>
+bool filter_iterator<Iterator, Predicate>::operator!=(const filter_iterator<Iterator, Predicate> &it) const
+{
+    return !(*this == it);
+}
+
+/**
+ * @brief Constructor for the take_iterator.
+ *
+ * @param current The underlying iterator.
+ * @param remaining The number of values left to take.
+ */
+template <typename Iterator>
+take_iterator<Iterator>::take_iterator(Iterator current, const size_t &remaining):
+    current(current), remaining(remaining) {}
+
+/**
+ * @brief Prefix increment operator for the take_iterator.
+ *
+ * The underlying iterator is left on the last value once the count is used up.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename Iterator>
+take_iterator<Iterator> &take_iterator<Iterator>::operator++()
+{
+    this->remaining--;
+    if (this->remaining != 0)
+        ++this->current;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the take_iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename Iterator>
+take_iterator<Iterator> take_iterator<Iterator>::operator++(int)
+{
+    take_iterator<Iterator> it = *this;
+    ++*this;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the take_iterator.
+ *
+ * @return The underlying value.
+ */
+template <typename Iterator>
+typename take_iterator<Iterator>::reference take_iterator<Iterator>::operator*() const
+{
+    return *this->current;
+}
+
+/**
+ * @brief Equality operator for the take_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both have taken every value, or the underlying iterators are equal.
+ */
+template <typename Iterator>
+bool take_iterator<Iterator>::operator==(const take_iterator<Iterator> &it) const
+{
+    return (this->remaining == 0 && it.remaining == 0) || this->current == it.current;
+}
+
+/**
+ * @brief Inequality operator for the take_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the iterators are not equal, false otherwise.
+ */
+template <typename Iterator>
+bool take_iterator<Iterator>::operator!=(const take_iterator<Iterator> &it) const
+{
+    return !(*this == it);
+}
+
+/**
+ * @brief Constructor for the zip_iterator.
+ *
+ * @param left The iterator giving the first value of each pair.
+ * @param right The iterator giving the second value of each pair.
+ */
+template <typename Left, typename Right>
+zip_iterator<Left, Right>::zip_iterator(Left left, Right right):
+    left(left), right(right) {}
+
+/**
+ * @brief Prefix increment operator for the zip_iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename Left, typename Right>
+zip_iterator<Left, Right> &zip_iterator<Left, Right>::operator++()
+{
+    ++this->left;
+    ++this->right;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the zip_iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename Left, typename Right>
+zip_iterator<Left, Right> zip_iterator<Left, Right>::operator++(int)
+{
+    zip_iterator<Left, Right> it = *this;
+    ++*this;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the zip_iterator.
+ *
+ * @return A pair of the two underlying values.
+ */
+template <typename Left, typename Right>
+typename zip_iterator<Left, Right>::reference zip_iterator<Left, Right>::operator*() const
+{
+    return reference(*this->left, *this->right);
+}
+
+/**
+ * @brief Equality operator for the zip_iterator.
+ *
+ * Either pair of underlying iterators being equal is enough, so the shorter
+ * range ends the iteration.
+ *
+ * @param it The iterator to compare with.
+ * @return true If either underlying iterator matches, false otherwise.
+ */
+template <typename Left, typename Right>
+bool zip_iterator<Left, Right>::operator==(const zip_iterator<Left, Right> &it) const
+{
+    return this->left == it.left || this->right == it.right;
+}
+
+/**
+ * @brief Inequality operator for the zip_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If neither underlying iterator matches, false otherwise.
+ */
+template <typename Left, typename Right>
+bool zip_iterator<Left, Right>::operator!=(const zip_iterator<Left, Right> &it) const
+{
+    return !(*this == it);
+}
+
+/**
+ * @brief Constructor for the enumerate_iterator.
+ *
+ * @param current The underlying iterator.
+ * @param index The position of the value `current` points to.
+ */
+template <typename Iterator>
+enumerate_iterator<Iterator>::enumerate_iterator(Iterator current, const size_t &index):
+    current(current), index(index) {}
+
+/**
+ * @brief Prefix increment operator for the enumerate_iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename Iterator>
+enumerate_iterator<Iterator> &enumerate_iterator<Iterator>::operator++()
+{
+    ++this->current;
+    this->index++;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the enumerate_iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename Iterator>
+enumerate_iterator<Iterator> enumerate_iterator<Iterator>::operator++(int)
+{
+    enumerate_iterator<Iterator> it = *this;
+    ++*this;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the enumerate_iterator.
+ *
+ * @return A pair of the position and the underlying value.
+ */
+template <typename Iterator>
+typename enumerate_iterator<Iterator>::reference enumerate_iterator<Iterator>::operator*() const
+{
+    return reference(this->index, *this->current);
+}
+
+/**
+ * @brief Equality operator for the enumerate_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both underlying iterators are equal, false otherwise.
+ */
+template <typename Iterator>
+bool enumerate_iterator<Iterator>::operator==(const enumerate_iterator<Iterator> &it) const
+{
+    return this->current == it.current;
+}
+
+/**
+ * @brief Inequality operator for the enumerate_iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the underlying iterators differ, false otherwise.
+ */
+template <typename Iterator>
+bool enumerate_iterator<Iterator>::operator!=(const enumerate_iterator<Iterator> &it) const
+{
+    return !(*this == it);
+}
+
+/**
+ * @brief Constructor for a view over `[first, last)`.
+ *
+ * @param first The beginning of the range.
+ * @param last The end of the range.
+ */
+template <typename Iterator>
+list_view<Iterator>::list_view(Iterator first, Iterator last):
+    first(first), last(last) {}
+
+/**
+ * @brief Get an iterator to the first value of the view.
+ *
+ * @return The beginning of the view.
+ */
+template <typename Iterator>
+typename list_view<Iterator>::iterator list_view<Iterator>::begin() const
+{
+    return this->first;
+}
+
+/**
+ * @brief Get an iterator past the last value of the view.
+ *
+ * @return The end of the view.
+ */
+template <typename Iterator>
+typename list_view<Iterator>::iterator list_view<Iterator>::end() const
+{
+    return this->last;
+}
+
+/**
+ * @brief Returns a view of every value passed through a function.
+ *
+ * @tparam Function A callable taking a value of this view.
+ * @param func The function to apply, called each time a value is read.
+ * @return A view of the results.
+ */
+template <typename Iterator>
+template <typename Function>
+list_view<map_iterator<Iterator, Function>> list_view<Iterator>::map(Function func) const
+{
+    return list_view<map_iterator<Iterator, Function>>(map_iterator<Iterator, Function>(this->first, func), map_iterator<Iterator, Function>(this->last, func));
+}
+
+/**
+ * @brief Returns a view of the values that satisfy a predicate.
+ *
+ * @tparam Predicate A callable taking a value of this view and returning bool.
+ * @param pred The predicate values must satisfy.
+ * @return A view of the accepted values.
+ */
+template <typename Iterator>
+template <typename Predicate>
+list_view<filter_iterator<Iterator, Predicate>> list_view<Iterator>::filter(Predicate pred) const
+{
+    return list_view<filter_iterator<Iterator, Predicate>>(filter_iterator<Iterator, Predicate>(this->first, this->last, pred), filter_iterator<Iterator, Predicate>(this->last, this->last, pred));
+}
+
+/**
+ * @brief Returns a view of at most the first `count` values.
+ *
+ * @param count The number of values to take.
+ * @return A view of the first `count` values, or of all of them if there are fewer.
+ */
+template <typename Iterator>
+list_view<take_iterator<Iterator>> list_view<Iterator>::take(const size_t &count) const
+{
+    return list_view<take_iterator<Iterator>>(take_iterator<Iterator>(this->first, count), take_iterator<Iterator>(this->last, 0));
+}
+
+/**
+ * @brief Returns a view without the first `count` values.
+ *
+ * The skipped values are read when `drop` is called.
+ *
+ * @param count The number of values to skip.
+ * @return A view of the remaining values, empty if there are `count` or fewer.
+ */
+template <typename Iterator>
+list_view<Iterator> list_view<Iterator>::drop(const size_t &count) const
+{
+    Iterator it = this->first;
+    for (size_t i = 0; i < count && it != this->last; i++)
+        ++it;
+
+    return list_view<Iterator>(it, this->last);
+}
+
+/**
+ * @brief Returns a view of pairs taken from this view and another in step.
+ *
+ * @tparam Other The iterator of the other view.
+ * @param other The view giving the second value of each pair.
+ * @return A view as long as the shorter of the two.
+ */
+template <typename Iterator>
+template <typename Other>
+list_view<zip_iterator<Iterator, Other>> list_view<Iterator>::zip(const list_view<Other> &other) const
+{
+    return list_view<zip_iterator<Iterator, Other>>(zip_iterator<Iterator, Other>(this->first, other.begin()), zip_iterator<Iterator, Other>(this->last, other.end()));
+}
+
+/**
+ * @brief Returns a view of pairs of each value's position and the value.
+ *
+ * @return A view of `(index, value)` pairs, counting from 0.
+ */
+template <typename Iterator>
+list_view<enumerate_iterator<Iterator>> list_view<Iterator>::enumerate() const
+{
+    return list_view<enumerate_iterator<Iterator>>(enumerate_iterator<Iterator>(this->first, 0), enumerate_iterator<Iterator>(this->last, 0));
+}
+
+/**
+ * @brief Builds a list from the values of the view in one pass.
+ *
+ * @tparam List A default-constructible list with `append`, e.g. `singly_linked_list<B>`.
+ * @return The new list.
+ */
+template <typename Iterator>
+template <typename List>
+List list_view<Iterator>::collect() const
+{
+    List list;
+    this->collect(list);
+
+    return list;
+}
+
+/**
+ * @brief Appends the values of the view to an existing list in one pass.
+ *
+ * @tparam List A list with `append`.
+ * @param list The list to append to.
+ */
+template <typename Iterator>
+template <typename List>
+void list_view<Iterator>::collect(List &list) const
+{
+    for (Iterator it = this->first; it != this->last; ++it)
+        list.append(*it);
+}
+
+/**
+ * @brief Returns a view over every value of a list or other range.
+ *
+ * A const list gives a view of const values.
+ *
+ * @tparam Range Any type with `begin()` and `end()`, such as a list or a generator.
+ * @param range The range to view. It must outlive the view.
+ * @return A view from `range.begin()` to `range.end()`.
+ */
+template <typename Range>
+auto view(Range &range) -> list_view<decltype(range.begin())>
+{
+    return list_view<decltype(range.begin())>(range.begin(), range.end());
+}
+
+#ifdef LINKEDLIST_GENERATOR
+
+/**
+ * @brief Creates the generator object returned to the caller of the coroutine.
+ *
+ * @return A generator owning the coroutine.
+ */
+template <typename A>
+generator<A> generator<A>::promise_type::get_return_object()
+{
+    return generator<A>(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+/**
+ * @brief Suspends the coroutine before its body runs, until the first value is asked for.
+ */
+template <typename A>
+std::suspend_always generator<A>::promise_type::initial_suspend() const noexcept
+{
+    return std::suspend_always();
+}
+
+/**
+ * @brief Keeps the finished coroutine alive so the generator can destroy it.
+ */
+template <typename A>
+std::suspend_always generator<A>::promise_type::final_suspend() const noexcept
+{
+    return std::suspend_always();
+}
+
+/**
+ * @brief Handles `co_yield`, suspending the coroutine at the produced value.
+ *
+ * The value lives in the coroutine until it is resumed, so it is not copied.
+ *
+ * @param value The value produced.
+ */
+template <typename A>
+std::suspend_always generator<A>::promise_type::yield_value(const A &value) noexcept
+{
+    this->current = &value;
+
+    return std::suspend_always();
+}
+
+/**
+ * @brief Handles the end of the coroutine body.
+ */
+template <typename A>
+void generator<A>::promise_type::return_void() const noexcept {}
+
+/**
+ * @brief Keeps an exception thrown by the coroutine for the iterator to rethrow.
+ */
+template <typename A>
+void generator<A>::promise_type::unhandled_exception()
+{
+    this->exception = std::current_exception();
+}
+
+/**
+ * @brief Default constructor for the iterator, equal to `end()`.
+ */
+template <typename A>
+generator<A>::iterator::iterator():
+    handle(nullptr) {}
+
+/**
+ * @brief Constructor for the iterator.
+ *
+ * @param handle The coroutine to pull values from.
+ */
+template <typename A>
+generator<A>::iterator::iterator(std::coroutine_handle<promise_type> handle):
+    handle(handle) {}
+
+/**
+ * @brief Checks if the coroutine has no more values.
+ *
+ * @return true if there is no coroutine or it has finished, otherwise false.
+ */
+template <typename A>
+bool generator<A>::iterator::exhausted() const
+{
+    return !this->handle || this->handle.done();
+}
+
+/**
+ * @brief Runs the coroutine to its next `co_yield`.
+ *
+ * @return A reference to the updated iterator.
+ * @throws Whatever the coroutine threw, once; the iterator then equals `end()`.
+ */
+template <typename A>
+typename generator<A>::iterator &generator<A>::iterator::operator++()
+{
+    this->handle.resume();
+
+    if (this->handle.promise().exception)
+    {
+        std::exception_ptr exception = this->handle.promise().exception;
+        this->handle.promise().exception = nullptr;
+        std::rethrow_exception(exception);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the iterator.
+ *
+ * The previous value is not kept by the coroutine, so nothing is returned.
+ */
+template <typename A>
+void generator<A>::iterator::operator++(int)
+{
+    ++*this;
+}
+
+/**
+ * @brief Dereference operator for the iterator.
+ *
+ * @return The value the coroutine last produced, valid until the next increment.
+ */
+template <typename A>
+const A &generator<A>::iterator::operator*() const
+{
+    return *this->handle.promise().current;
+}
+
+/**
+ * @brief Member access operator for the iterator.
+ *
+ * @return A pointer to the value the coroutine last produced.
+ */
+template <typename A>
+const A *generator<A>::iterator::operator->() const
+{
+    return this->handle.promise().current;
+}
+
+/**
+ * @brief Equality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both iterators are exhausted or both are not, false otherwise.
+ */
+template <typename A>
+bool generator<A>::iterator::operator==(const iterator &it) const
+{
+    return this->exhausted() == it.exhausted();
+}
+
+/**
+ * @brief Inequality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If exactly one of the iterators is exhausted, false otherwise.
+ */
+template <typename A>
+bool generator<A>::iterator::operator!=(const iterator &it) const
+{
+    return !(*this == it);
+}
+
+/**
+ * @brief Constructor for a generator owning a coroutine.
+ *
+ * @param handle The coroutine.
+ */
+template <typename A>
+generator<A>::generator(std::coroutine_handle<promise_type> handle):
+    handle(handle) {}
+
+/**
+ * @brief Move constructor, leaving `obj` without a coroutine.
+ *
+ * @param obj The generator to move from.
+ */
+template <typename A>
+generator<A>::generator(generator<A> &&obj) noexcept:
+    handle(obj.handle)
+{
+    obj.handle = nullptr;
+}
+
+/**
+ * @brief Move assignment operator.
+ *
+ * @param obj The generator to move from, left without a coroutine.
+ * @return A reference to this generator.
+ */
+template <typename A>
+generator<A> &generator<A>::operator=(generator<A> &&obj) noexcept
+{
+    if (this == &obj)
+        return *this;
+
+    if (this->handle)
+        this->handle.destroy();
+
+    this->handle = obj.handle;
+    obj.handle = nullptr;
+
+    return *this;
+}
+
+/**
+ * @brief Starts the coroutine and runs it to its first `co_yield`.
+ *
+ * @return An iterator to the first value, or `end()` if there is none.
+ * @throws Whatever the coroutine threw before its first value.
+ */
+template <typename A>
+typename generator<A>::iterator generator<A>::begin()
+{
+    iterator it(this->handle);
+    if (this->handle)
+        ++it;
+
+    return it;
+}
+
+/**
+ * @brief Get the iterator every exhausted iterator equals.
+ *
+ * @return The end iterator.
+ */
+template <typename A>
+typename generator<A>::iterator generator<A>::end()
+{
+    return iterator();
+}
+
+/**
+ * @brief Destructor, destroying the coroutine and the locals it holds.
+ */
+template <typename A>
+generator<A>::~generator()
+{
+    if (this->handle)
+        this->handle.destroy();
+}
+
+#endif
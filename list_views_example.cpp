@@ -0,0 +1,69 @@
+#include <iostream>
+#include <string>
+
+#include "singly_linked_list.hpp"
+#include "doubly_linked_list.hpp"
+#include "list_views.hpp"
+
+/**
+ * @file list_views_example.cpp
+ * @brief Demonstrates lazy views over linked lists.
+ *
+ * This program chains `filter`, `map`, `drop`, `take`, `zip` and `enumerate`
+ * over lists without building an intermediate list for any step, and, with
+ * C++20, fills a list straight from a coroutine generator.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+#ifdef LINKEDLIST_GENERATOR
+generator<int> squares()
+{
+    for (int i = 1; ; i++)
+        co_yield i * i;
+}
+#endif
+
+int main()
+{
+    singly_linked_list<int> readings = {12, -1, 7, 30, -4, 18, 25, 3, 41};
+
+    // One pass over `readings`, one list built at the end
+    singly_linked_list<int> scaled = view(readings)
+        .filter([](const int &x) { return x >= 0; })
+        .map([](const int &x) { return x * 10; })
+        .drop(1)
+        .take(4)
+        .collect<singly_linked_list<int>>();
+    std::cout << "scaled: " << scaled << std::endl; // scaled: [70, 300, 180, 250]
+
+    doubly_linked_list<std::string> sensors = {"north", "east", "south"};
+    for (auto pair: view(sensors).zip(view(readings)))
+        std::cout << pair.first << " = " << pair.second << std::endl; // north = 12, east = -1, south = 7
+
+    // Views over a non-const list give references, so values can be changed in place
+    for (auto pair: view(sensors).enumerate())
+        pair.second = std::to_string(pair.first) + ":" + pair.second;
+    std::cout << "sensors: " << sensors << std::endl; // sensors: [0:north, 1:east, 2:south]
+
+#ifdef LINKEDLIST_GENERATOR
+    // The generator never ends; take(5) stops asking it for values
+    generator<int> source = squares();
+    singly_linked_list<int> odd_squares = view(source)
+        .filter([](const int &x) { return x % 2 == 1; })
+        .take(5)
+        .collect<singly_linked_list<int>>();
+    std::cout << "odd squares: " << odd_squares << std::endl; // odd squares: [1, 9, 25, 49, 81]
+
+    // A view over a generator can be iterated like any other
+    generator<int> more = squares();
+    singly_linked_list<int> first_squares;
+    for (int value: view(more).take(3))
+        first_squares.append(value);
+    std::cout << "first squares: " << first_squares << std::endl; // first squares: [1, 4, 9]
+#endif
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+#if __cplusplus >= 201103L
+
+#ifndef MAPPED_LINKED_LIST_H
+#define MAPPED_LINKED_LIST_H
+
+#if !defined(__unix__) && !defined(__APPLE__)
+    #error "mapped_linked_list requires POSIX mmap.\n"
+#endif
+
+#include <cstdint>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "./linkedlist.hpp"
+
+#define MAPPED_LIST_VERSION 1
+
+/**
+ * @brief A singly linked list whose nodes live in a memory-mapped file.
+ *
+ * The file starts with a 64-byte header holding the magic `LLMAPPED`, a format
+ * version, the size of the value type, the number of node slots in the file,
+ * and the head, tail, free list and length of the list. The slots follow, each
+ * a value and the index of the next slot, so the links stay valid wherever the
+ * file is mapped. Everything is in native byte order.
+ *
+ * Opening an existing file only maps it: the list is available at once and its
+ * pages are read in as they are touched. Changes go to the mapping and reach
+ * the file when the system writes the pages back; sync() waits for that, so
+ * call it where the list has to survive a crash. Removed slots go on a free
+ * list and are reused. The file grows geometrically, which remaps it, so
+ * references to values do not survive adding a value; iterators hold slot
+ * indices and do.
+ *
+ * Only trivially copyable value types can be stored. A file belongs to one
+ * list object at a time.
+ *
+ * @tparam A The value type.
+ */
+template <typename A>
+class mapped_linked_list final: public static_list<mapped_linked_list<A>>
+{
+    static_assert(std::is_trivially_copyable<A>::value, "mapped_linked_list requires a trivially copyable value type");
+
+    private:
+        typedef struct node
+        {
+            A value;
+            uint64_t next;
+        } node;
+
+        typedef struct header
+        {
+            char magic[8];
+            uint32_t version;
+            uint32_t value_size;
+            uint64_t capacity, used;
+            uint64_t head, tail, unused;
+            uint64_t length;
+        } header;
+
+        static constexpr uint64_t nil = UINT64_MAX;
+        static constexpr size_t header_size = 64;
+
+        std::string path;
+        int fd;
+        size_t mapped;
+        header *meta;
+        node *nodes;
+
+        void map(const size_t &bytes);
+        void unmap();
+        void resize(const uint64_t &capacity);
+
+        uint64_t getslot(const int64_t &index) const;
+        uint64_t acquire(const A &value);
+        A unlink(uint64_t prev, uint64_t index);
+        void relayout(const std::vector<A> &ordered);
+    public:
+        typedef A value_type;
+
+        class iterator
+        {
+            private:
+                mapped_linked_list<A> *list;
+                uint64_t index;
+
+                iterator(mapped_linked_list<A> *list, uint64_t index);
+
+                friend class mapped_linked_list<A>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef A *pointer;
+                typedef A &reference;
+
+                iterator();
+
+                iterator &operator++();
+                iterator operator++(int);
+                A &operator*() const;
+                A *operator->() const;
+                bool operator==(const iterator &it) const;
+                bool operator!=(const iterator &it) const;
+        };
+
+        class const_iterator
+        {
+            private:
+                const mapped_linked_list<A> *list;
+                uint64_t index;
+
+                const_iterator(const mapped_linked_list<A> *list, uint64_t index);
+
+                friend class mapped_linked_list<A>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const A *pointer;
+                typedef const A &reference;
+
+                const_iterator();
+                const_iterator(const iterator &it);
+
+                const_iterator &operator++();
+                const_iterator operator++(int);
+                const A &operator*() const;
+                const A *operator->() const;
+                bool operator==(const const_iterator &it) const;
+                bool operator!=(const const_iterator &it) const;
+        };
+
+        explicit mapped_linked_list(const std::string &path);
+
+        mapped_linked_list(mapped_linked_list<A> &&obj);
+        mapped_linked_list(const mapped_linked_list<A> &obj) = delete;
+
+        mapped_linked_list<A> &operator=(mapped_linked_list<A> &&obj);
+        mapped_linked_list<A> &operator=(const mapped_linked_list<A> &obj) = delete;
+
+        void prepend(const A &value);
+        void append(const A &value);
+        void insert(const int64_t &index, const A &value);
+        void insert_in_order(const A &value);
+
+        void extend(const std::initializer_list<A> &values);
+
+        template <size_t N>
+        void extend(const A (&array)[N]);
+        void extend(const std::vector<A> &values);
+        template <typename Allocator>
+        void extend(const linkedlist<A, Allocator> &obj);
+
+        void remove(const A &value);
+        A pop(const int64_t &index);
+        A pop();
+
+        size_t size() const;
+        bool isempty() const;
+
+        bool contains(const A &value) const;
+        int64_t index(const A &value) const;
+        size_t count(const A &value) const;
+
+        void reverse();
+        void sort();
+
+        void reserve(const size_t &capacity);
+        size_t capacity() const;
+        void compact();
+        void sync();
+        const std::string &file() const;
+        list_memory memory_usage() const;
+
+        A &operator[](const int64_t &index);
+        const A &operator[](const int64_t &index) const;
+
+        bool operator>(const mapped_linked_list<A> &obj) const;
+        bool operator<(const mapped_linked_list<A> &obj) const;
+        bool operator>=(const mapped_linked_list<A> &obj) const;
+        bool operator<=(const mapped_linked_list<A> &obj) const;
+        bool operator==(const mapped_linked_list<A> &obj) const;
+        bool operator!=(const mapped_linked_list<A> &obj) const;
+
+        operator std::vector<A>() const;
+
+        std::string to_string() const;
+        void show() const;
+
+        void clear();
+
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        template <typename B>
+        friend B min(const mapped_linked_list<B> &obj);
+
+        template <typename B>
+        friend B max(const mapped_linked_list<B> &obj);
+
+        template <typename B>
+        friend std::ostream &operator<<(std::ostream &out, const mapped_linked_list<B> &obj);
+
+        ~mapped_linked_list();
+};
+
+template <typename A>
+A min(const mapped_linked_list<A> &obj);
+
+template <typename A>
+A max(const mapped_linked_list<A> &obj);
+
+template <typename A>
+size_t len(const mapped_linked_list<A> &obj);
+
+template <typename A>
+std::ostream &operator<<(std::ostream &out, const mapped_linked_list<A> &obj);
+
+#include "./mapped_linked_list.tpp"
+
+#endif
+
+#else
+    #error "Requires C++11 or later.\n"
+
+#endif
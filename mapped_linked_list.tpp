@@ -0,0 +1,1219 @@
+#include "./mapped_linked_list.hpp"
+
+#include <cstring>
+
+#if __cplusplus < 201703L
+template <typename A>
+constexpr uint64_t mapped_linked_list<A>::nil;
+
+template <typename A>
+constexpr size_t mapped_linked_list<A>::header_size;
+#endif
+
+/**
+ * @brief Default constructor for the iterator.
+ *
+ * Initializes an iterator that points past the end of no list.
+ */
+template <typename A>
+mapped_linked_list<A>::iterator::iterator():
+    list(nullptr), index(nil) {}
+
+/**
+ * @brief Constructor for the iterator.
+ *
+ * @param list The list the iterator walks.
+ * @param index The slot the iterator will point to, nil for the end.
+ */
+template <typename A>
+mapped_linked_list<A>::iterator::iterator(mapped_linked_list<A> *list, uint64_t index):
+    list(list), index(index) {}
+
+/**
+ * @brief Prefix increment operator for the iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename A>
+typename mapped_linked_list<A>::iterator &mapped_linked_list<A>::iterator::operator++()
+{
+    this->index = this->list->nodes[this->index].next;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the iterator.
+ *
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename A>
+typename mapped_linked_list<A>::iterator mapped_linked_list<A>::iterator::operator++(int)
+{
+    iterator it = *this;
+    this->index = this->list->nodes[this->index].next;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the iterator.
+ *
+ * @return A reference to the value the iterator points to.
+ */
+template <typename A>
+A &mapped_linked_list<A>::iterator::operator*() const
+{
+    return this->list->nodes[this->index].value;
+}
+
+/**
+ * @brief Member access operator for the iterator.
+ *
+ * @return A pointer to the value the iterator points to.
+ */
+template <typename A>
+A *mapped_linked_list<A>::iterator::operator->() const
+{
+    return &this->list->nodes[this->index].value;
+}
+
+/**
+ * @brief Equality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both iterators point to the same slot, false otherwise.
+ */
+template <typename A>
+bool mapped_linked_list<A>::iterator::operator==(const iterator &it) const
+{
+    return this->index == it.index;
+}
+
+/**
+ * @brief Inequality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the iterators point to different slots, false otherwise.
+ */
+template <typename A>
+bool mapped_linked_list<A>::iterator::operator!=(const iterator &it) const
+{
+    return this->index != it.index;
+}
+
+/**
+ * @brief Default constructor for the const_iterator.
+ *
+ * Initializes a const_iterator that points past the end of no list.
+ */
+template <typename A>
+mapped_linked_list<A>::const_iterator::const_iterator():
+    list(nullptr), index(nil) {}
+
+/**
+ * @brief Constructor for the const_iterator.
+ *
+ * @param list The list the const_iterator walks.
+ * @param index The slot the const_iterator will point to, nil for the end.
+ */
+template <typename A>
+mapped_linked_list<A>::const_iterator::const_iterator(const mapped_linked_list<A> *list, uint64_t index):
+    list(list), index(index) {}
+
+/**
+ * @brief Converts an iterator to a const_iterator at the same slot.
+ *
+ * @param it The iterator to convert.
+ */
+template <typename A>
+mapped_linked_list<A>::const_iterator::const_iterator(const iterator &it):
+    list(it.list), index(it.index) {}
+
+/**
+ * @brief Prefix increment operator for the const_iterator.
+ *
+ * @return A reference to the updated const_iterator.
+ */
+template <typename A>
+typename mapped_linked_list<A>::const_iterator &mapped_linked_list<A>::const_iterator::operator++()
+{
+    this->index = this->list->nodes[this->index].next;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the const_iterator.
+ *
+ * @return A copy of the const_iterator before incrementing.
+ */
+template <typename A>
+typename mapped_linked_list<A>::const_iterator mapped_linked_list<A>::const_iterator::operator++(int)
+{
+    const_iterator it = *this;
+    this->index = this->list->nodes[this->index].next;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the const_iterator.
+ *
+ * @return A const reference to the value the const_iterator points to.
+ */
+template <typename A>
+const A &mapped_linked_list<A>::const_iterator::operator*() const
+{
+    return this->list->nodes[this->index].value;
+}
+
+/**
+ * @brief Member access operator for the const_iterator.
+ *
+ * @return A pointer to the value the const_iterator points to.
+ */
+template <typename A>
+const A *mapped_linked_list<A>::const_iterator::operator->() const
+{
+    return &this->list->nodes[this->index].value;
+}
+
+/**
+ * @brief Equality operator for the const_iterator.
+ *
+ * @param it The const_iterator to compare with.
+ * @return true If both const_iterators point to the same slot, false otherwise.
+ */
+template <typename A>
+bool mapped_linked_list<A>::const_iterator::operator==(const const_iterator &it) const
+{
+    return this->index == it.index;
+}
+
+/**
+ * @brief Inequality operator for the const_iterator.
+ *
+ * @param it The const_iterator to compare with.
+ * @return true If the const_iterators point to different slots, false otherwise.
+ */
+template <typename A>
+bool mapped_linked_list<A>::const_iterator::operator!=(const const_iterator &it) const
+{
+    return this->index != it.index;
+}
+
+/**
+ * @brief Opens the list stored in a file, creating an empty one if the file does not exist.
+ *
+ * An existing file is mapped and checked, but none of its nodes are read.
+ *
+ * @param path The file holding the list.
+ * @throws VALUE_ERROR If the file cannot be opened or mapped, or is not a list of this format version.
+ * @throws TYPE_ERROR If the file holds values of a different size than `A`.
+ */
+template <typename A>
+mapped_linked_list<A>::mapped_linked_list(const std::string &path):
+    path(path), fd(-1), mapped(0), meta(nullptr), nodes(nullptr)
+{
+    static_assert(sizeof(header) <= header_size && header_size % alignof(node) == 0, "The header must fit in front of the first node");
+
+    this->fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (this->fd < 0)
+        throw VALUE_ERROR("Cannot open mapped list file");
+
+    try
+    {
+        struct stat info;
+        if (::fstat(this->fd, &info) != 0)
+            throw VALUE_ERROR("Cannot open mapped list file");
+
+        if (info.st_size == 0)
+        {
+            if (::ftruncate(this->fd, (off_t)header_size) != 0)
+                throw VALUE_ERROR("Cannot resize mapped list file");
+
+            this->map(header_size);
+            std::memcpy(this->meta->magic, "LLMAPPED", 8);
+            this->meta->version = MAPPED_LIST_VERSION;
+            this->meta->value_size = (uint32_t)sizeof(A);
+            this->meta->capacity = this->meta->used = 0;
+            this->meta->head = this->meta->tail = this->meta->unused = nil;
+            this->meta->length = 0;
+        }
+
+        else
+        {
+            if ((size_t)info.st_size < header_size)
+                throw VALUE_ERROR("Not a mapped list file");
+
+            this->map((size_t)info.st_size);
+            if (std::memcmp(this->meta->magic, "LLMAPPED", 8) != 0)
+                throw VALUE_ERROR("Not a mapped list file");
+            if (this->meta->version != MAPPED_LIST_VERSION)
+                throw VALUE_ERROR("Unsupported mapped list file version");
+            if (this->meta->value_size != sizeof(A))
+                throw TYPE_ERROR("Mapped list file holds values of a different size");
+            if (this->meta->capacity > ((size_t)info.st_size - header_size) / sizeof(node) || this->meta->used > this->meta->capacity)
+                throw VALUE_ERROR("Truncated mapped list file");
+        }
+    }
+    catch (...)
+    {
+        this->unmap();
+        ::close(this->fd);
+        throw;
+    }
+}
+
+/**
+ * @brief Move constructor, taking over the file of `obj`.
+ *
+ * `obj` is left without a file and can only be assigned to or destroyed.
+ *
+ * @param obj The list to move from.
+ */
+template <typename A>
+mapped_linked_list<A>::mapped_linked_list(mapped_linked_list<A> &&obj):
+    path(std::move(obj.path)), fd(obj.fd), mapped(obj.mapped), meta(obj.meta), nodes(obj.nodes)
+{
+    obj.fd = -1;
+    obj.mapped = 0;
+    obj.meta = nullptr;
+    obj.nodes = nullptr;
+}
+
+/**
+ * @brief Move assignment operator.
+ *
+ * Closes this list's file, without syncing it, and takes over the file of `obj`.
+ *
+ * @param obj The list to move from, left without a file.
+ * @return A reference to this list.
+ */
+template <typename A>
+mapped_linked_list<A> &mapped_linked_list<A>::operator=(mapped_linked_list<A> &&obj)
+{
+    if (this == &obj)
+        return *this;
+
+    this->unmap();
+    if (this->fd >= 0)
+        ::close(this->fd);
+
+    this->path = std::move(obj.path);
+    this->fd = obj.fd;
+    this->mapped = obj.mapped;
+    this->meta = obj.meta;
+    this->nodes = obj.nodes;
+
+    obj.fd = -1;
+    obj.mapped = 0;
+    obj.meta = nullptr;
+    obj.nodes = nullptr;
+
+    return *this;
+}
+
+/**
+ * @brief Maps the first bytes of the file.
+ *
+ * @param bytes The number of bytes to map, at least the header.
+ * @throws VALUE_ERROR If the file cannot be mapped.
+ */
+template <typename A>
+void mapped_linked_list<A>::map(const size_t &bytes)
+{
+    void *base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+    if (base == MAP_FAILED)
+        throw VALUE_ERROR("Cannot map list file");
+
+    this->mapped = bytes;
+    this->meta = static_cast<header *>(base);
+    this->nodes = reinterpret_cast<node *>(static_cast<char *>(base) + header_size);
+}
+
+/**
+ * @brief Unmaps the file, if it is mapped.
+ */
+template <typename A>
+void mapped_linked_list<A>::unmap()
+{
+    if (this->meta != nullptr)
+        ::munmap(this->meta, this->mapped);
+
+    this->mapped = 0;
+    this->meta = nullptr;
+    this->nodes = nullptr;
+}
+
+/**
+ * @brief Resizes the file to a number of node slots and maps it again.
+ *
+ * The links are slot indices, so they stay valid at the new address.
+ *
+ * @param capacity The number of node slots, at least the slots in use.
+ * @throws INDEX_ERROR If the file would be larger than the address space.
+ * @throws VALUE_ERROR If the file cannot be resized or mapped.
+ */
+template <typename A>
+void mapped_linked_list<A>::resize(const uint64_t &capacity)
+{
+    if (capacity > ((size_t)-1 - header_size) / sizeof(node))
+        throw INDEX_ERROR("List Capacity Exceeded");
+
+    const size_t bytes = header_size + (size_t)capacity * sizeof(node), previous = this->mapped;
+
+    this->unmap();
+    if (::ftruncate(this->fd, (off_t)bytes) != 0)
+    {
+        this->map(previous);
+        throw VALUE_ERROR("Cannot resize mapped list file");
+    }
+
+    this->map(bytes);
+    this->meta->capacity = capacity;
+}
+
+/**
+ * @brief Returns the slot at a position of the list.
+ *
+ * @param index The position, negative positions count from the end. Must be in range.
+ * @return The index of the slot.
+ */
+template <typename A>
+uint64_t mapped_linked_list<A>::getslot(const int64_t &index) const
+{
+    int64_t position = (index < 0L) ? index + (int64_t)this->meta->length : index;
+    if (position == (int64_t)this->meta->length - 1L)
+        return this->meta->tail;
+
+    uint64_t ptr = this->meta->head;
+    for (int64_t i = 0; i < position; i++)
+        ptr = this->nodes[ptr].next;
+    LINKEDLIST_STAT_HOPS(position);
+
+    return ptr;
+}
+
+/**
+ * @brief Takes a slot off the free list, or a fresh one from the file, and stores a value in it.
+ *
+ * The file doubles when it runs out of slots. The slot is not linked into the
+ * list yet, but counts towards its length.
+ *
+ * @param value The value to store; it may live in this list.
+ * @return The index of the slot.
+ * @throws VALUE_ERROR If the file cannot be grown.
+ */
+template <typename A>
+uint64_t mapped_linked_list<A>::acquire(const A &value)
+{
+    // Growing remaps the file, which would leave `value` dangling if it is one of ours
+    const A stored = value;
+
+    uint64_t index = this->meta->unused;
+    if (index != nil)
+        this->meta->unused = this->nodes[index].next;
+
+    else
+    {
+        if (this->meta->used == this->meta->capacity)
+            this->resize(std::max<uint64_t>(16, this->meta->capacity * 2));
+
+        index = this->meta->used++;
+    }
+    LINKEDLIST_STAT_ALLOC();
+
+    this->nodes[index].value = stored;
+    this->nodes[index].next = nil;
+
+    this->meta->length++;
+    return index;
+}
+
+/**
+ * @brief Unlinks a slot from the list and returns it to the free list.
+ *
+ * @param prev The slot before `index`, nil if `index` is the head.
+ * @param index The slot to unlink.
+ * @return The value that was stored in the slot.
+ */
+template <typename A>
+A mapped_linked_list<A>::unlink(uint64_t prev, uint64_t index)
+{
+    if (prev == nil)
+        this->meta->head = this->nodes[index].next;
+    else
+        this->nodes[prev].next = this->nodes[index].next;
+
+    if (this->meta->tail == index)
+        this->meta->tail = prev;
+
+    this->nodes[index].next = this->meta->unused;
+    this->meta->unused = index;
+    LINKEDLIST_STAT_FREE();
+
+    this->meta->length--;
+    return this->nodes[index].value;
+}
+
+/**
+ * @brief Rewrites the slots with values already in list order.
+ *
+ * Slot `i` then holds the `i`th value and links to slot `i + 1`, and no slot is
+ * on the free list. The file must already hold `ordered.size()` slots.
+ *
+ * @param ordered The values of the list, in order.
+ */
+template <typename A>
+void mapped_linked_list<A>::relayout(const std::vector<A> &ordered)
+{
+    const uint64_t length = ordered.size();
+    for (uint64_t i = 0; i < length; i++)
+    {
+        this->nodes[i].value = ordered[i];
+        this->nodes[i].next = (i + 1 == length) ? nil : i + 1;
+    }
+
+    this->meta->length = this->meta->used = length;
+    this->meta->head = (length == 0) ? nil : 0;
+    this->meta->tail = (length == 0) ? nil : length - 1;
+    this->meta->unused = nil;
+}
+
+/**
+ * @brief Prepend a value to the list.
+ * @param value The value to prepend.
+ * @throws VALUE_ERROR If the file cannot be grown.
+ */
+template <typename A>
+void mapped_linked_list<A>::prepend(const A &value)
+{
+    uint64_t index = this->acquire(value);
+    this->nodes[index].next = this->meta->head;
+
+    if (this->meta->tail == nil)
+        this->meta->tail = index;
+
+    this->meta->head = index;
+}
+
+/**
+ * @brief Append a value to the list.
+ * @param value The value to append.
+ * @throws VALUE_ERROR If the file cannot be grown.
+ */
+template <typename A>
+void mapped_linked_list<A>::append(const A &value)
+{
+    uint64_t index = this->acquire(value);
+
+    if (this->meta->head == nil)
+        this->meta->head = index;
+    else
+        this->nodes[this->meta->tail].next = index;
+
+    this->meta->tail = index;
+}
+
+/**
+ * @brief Insert a value before a position of the list.
+ *
+ * Negative positions count from the end; positions past either end insert at that end.
+ *
+ * @param index The position to insert at.
+ * @param value The value to insert.
+ * @throws VALUE_ERROR If the file cannot be grown.
+ */
+template <typename A>
+void mapped_linked_list<A>::insert(const int64_t &index, const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert);
+
+    int64_t position = (index < 0L) ? index + (int64_t)this->meta->length : index;
+
+    if (position <= 0L)
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (position >= (int64_t)this->meta->length)
+    {
+        this->append(value);
+        return;
+    }
+
+    uint64_t prev = this->getslot(position - 1L);
+    uint64_t slot = this->acquire(value);
+
+    this->nodes[slot].next = this->nodes[prev].next;
+    this->nodes[prev].next = slot;
+}
+
+/**
+ * @brief Insert a value keeping an ascending list sorted.
+ * @param value The value to insert.
+ * @throws VALUE_ERROR If the file cannot be grown.
+ */
+template <typename A>
+void mapped_linked_list<A>::insert_in_order(const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert_in_order);
+
+    if (this->isempty() || this->nodes[this->meta->head].value >= value)
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (this->nodes[this->meta->tail].value <= value)
+    {
+        this->append(value);
+        return;
+    }
+
+    uint64_t ptr = this->meta->head;
+    while (this->nodes[ptr].next != nil && this->nodes[this->nodes[ptr].next].value < value)
+        ptr = this->nodes[ptr].next;
+
+    uint64_t slot = this->acquire(value);
+    this->nodes[slot].next = this->nodes[ptr].next;
+    this->nodes[ptr].next = slot;
+}
+
+/**
+ * @brief Extends the list with values from an initializer list.
+ * @param values The values to append.
+ */
+template <typename A>
+void mapped_linked_list<A>::extend(const std::initializer_list<A> &values)
+{
+    this->reserve(this->meta->length + values.size());
+    this->append_range(values.begin(), values.end());
+}
+
+/**
+ * @brief Extends the list with values from an array.
+ * @param array The values to append.
+ */
+template <typename A>
+template <size_t N>
+void mapped_linked_list<A>::extend(const A (&array)[N])
+{
+    this->reserve(this->meta->length + N);
+    this->append_range(array, array + N);
+}
+
+/**
+ * @brief Extends the list with values from a vector.
+ *
+ * The file is grown once, up front, rather than doubling as the values are added.
+ *
+ * @param values The values to append.
+ */
+template <typename A>
+void mapped_linked_list<A>::extend(const std::vector<A> &values)
+{
+    this->reserve(this->meta->length + values.size());
+    this->append_range(values.begin(), values.end());
+}
+
+/**
+ * @brief Extends the list with the values of another list, e.g. to save a `singly_linked_list` to a file.
+ * @param obj The list whose values are appended.
+ */
+template <typename A>
+template <typename Allocator>
+void mapped_linked_list<A>::extend(const linkedlist<A, Allocator> &obj)
+{
+    this->reserve(this->meta->length + obj.size());
+    this->append_range(obj.cbegin(), obj.cend());
+}
+
+/**
+ * @brief Removes the first occurrence of a value.
+ * @param value The value to remove.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A>
+void mapped_linked_list<A>::remove(const A &value)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    if (this->isempty())
+        throw VALUE_ERROR("Removing from Empty List");
+
+    uint64_t prev = nil, ptr = this->meta->head;
+    while (ptr != nil && !(this->nodes[ptr].value == value))
+    {
+        prev = ptr;
+        ptr = this->nodes[ptr].next;
+    }
+
+    if (ptr == nil)
+        throw VALUE_ERROR("Removing `x`, non-element in the List");
+
+    this->unlink(prev, ptr);
+}
+
+/**
+ * @brief Removes and returns the value at a position.
+ * @param index The position, negative positions count from the end.
+ * @return The removed value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A>
+A mapped_linked_list<A>::pop(const int64_t &index)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    if (this->isempty())
+        throw INDEX_ERROR("Pop from Empty List");
+
+    if (index < -(int64_t)(this->meta->length) || index >= (int64_t)(this->meta->length))
+        throw INDEX_ERROR("Pop index out of range");
+
+    int64_t position = (index < 0L) ? index + (int64_t)this->meta->length : index;
+    if (position == 0L)
+        return this->unlink(nil, this->meta->head);
+
+    uint64_t prev = this->getslot(position - 1L);
+    return this->unlink(prev, this->nodes[prev].next);
+}
+
+/**
+ * @brief Removes and returns the last value.
+ * @return The removed value.
+ * @throws INDEX_ERROR If the list is empty.
+ */
+template <typename A>
+A mapped_linked_list<A>::pop()
+{
+    return this->pop(-1L);
+}
+
+/**
+ * @brief Returns the number of values in the list.
+ * @return The number of values.
+ */
+template <typename A>
+size_t mapped_linked_list<A>::size() const
+{
+    return this->meta->length;
+}
+
+/**
+ * @brief Checks if the list is empty.
+ * @return true if the list holds no values, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::isempty() const
+{
+    return this->meta->head == nil;
+}
+
+/**
+ * @brief Checks if the list contains a value.
+ * @param value The value to search for.
+ * @return true if the value is found, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::contains(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::contains);
+
+    for (uint64_t ptr = this->meta->head; ptr != nil; ptr = this->nodes[ptr].next)
+        if (this->nodes[ptr].value == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Returns the position of the first occurrence of a value.
+ * @param value The value to search for.
+ * @return The position of the value.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A>
+int64_t mapped_linked_list<A>::index(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::index);
+
+    if (this->isempty())
+        throw VALUE_ERROR("Index of Element from Empty List");
+
+    int64_t curr_index = 0L;
+    for (uint64_t ptr = this->meta->head; ptr != nil; ptr = this->nodes[ptr].next)
+    {
+        if (this->nodes[ptr].value == value)
+            return curr_index;
+        curr_index++;
+    }
+
+    throw VALUE_ERROR("Value `x` not in List");
+}
+
+/**
+ * @brief Counts the occurrences of a value.
+ * @param value The value to count.
+ * @return The number of occurrences.
+ */
+template <typename A>
+size_t mapped_linked_list<A>::count(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::count);
+
+    size_t founds = 0;
+    for (uint64_t ptr = this->meta->head; ptr != nil; ptr = this->nodes[ptr].next)
+        if (this->nodes[ptr].value == value)
+            founds++;
+
+    return founds;
+}
+
+/**
+ * @brief Reverses the order of the values in place.
+ */
+template <typename A>
+void mapped_linked_list<A>::reverse()
+{
+    uint64_t current = this->meta->head, prev = nil;
+    this->meta->tail = this->meta->head;
+    while (current != nil)
+    {
+        uint64_t next_slot = this->nodes[current].next;
+        this->nodes[current].next = prev;
+        prev = current;
+        current = next_slot;
+    }
+
+    this->meta->head = prev;
+}
+
+/**
+ * @brief Sorts the list in ascending order.
+ *
+ * The values are copied out in list order, stably sorted as an array and
+ * written back in order, so slot `i` then holds the `i`th value.
+ */
+template <typename A>
+void mapped_linked_list<A>::sort()
+{
+    if (this->meta->length < 2)
+        return;
+
+    std::vector<A> ordered(*this);
+    std::stable_sort(ordered.begin(), ordered.end(), [](const A &left, const A &right) { return left < right; });
+    this->relayout(ordered);
+}
+
+/**
+ * @brief Grows the file to hold a number of values.
+ *
+ * @param capacity The number of values the file should hold without growing.
+ * @throws VALUE_ERROR If the file cannot be grown.
+ */
+template <typename A>
+void mapped_linked_list<A>::reserve(const size_t &capacity)
+{
+    if (capacity > this->meta->capacity)
+        this->resize(capacity);
+}
+
+/**
+ * @brief Returns the number of values the file holds without growing.
+ * @return The number of node slots in the file.
+ */
+template <typename A>
+size_t mapped_linked_list<A>::capacity() const
+{
+    return this->meta->capacity;
+}
+
+/**
+ * @brief Lays the list out in order and shrinks the file to fit it.
+ *
+ * Afterwards slot `i` holds the `i`th value, so a traversal reads the file
+ * front to back. Iterators are invalidated.
+ */
+template <typename A>
+void mapped_linked_list<A>::compact()
+{
+    std::vector<A> ordered(*this);
+    this->relayout(ordered);
+    this->resize(ordered.size());
+}
+
+/**
+ * @brief Writes the list to its file and waits until the file is on disk.
+ *
+ * @throws VALUE_ERROR If the file cannot be written.
+ */
+template <typename A>
+void mapped_linked_list<A>::sync()
+{
+    if (::msync(this->meta, this->mapped, MS_SYNC) != 0 || ::fsync(this->fd) != 0)
+        throw VALUE_ERROR("Cannot sync mapped list file");
+}
+
+/**
+ * @brief Returns the path of the file holding the list.
+ * @return The path the list was opened with.
+ */
+template <typename A>
+const std::string &mapped_linked_list<A>::file() const
+{
+    return this->path;
+}
+
+/**
+ * @brief Reports the bytes held by the list.
+ *
+ * These are bytes of the mapped file; only the pages that have been touched
+ * take up memory. Free and never used slots count as reserved, and the file
+ * header as control.
+ *
+ * @return The bytes used by values, links, node padding, spare slots and control structures.
+ */
+template <typename A>
+list_memory mapped_linked_list<A>::memory_usage() const
+{
+    list_memory usage = list_memory();
+    usage.payload = this->meta->length * sizeof(A);
+    usage.links = this->meta->length * sizeof(uint64_t);
+    usage.padding = this->meta->length * (sizeof(node) - sizeof(A) - sizeof(uint64_t));
+    usage.reserved = (this->meta->capacity - this->meta->length) * sizeof(node);
+    usage.control = sizeof(*this) + header_size;
+
+    return usage;
+}
+
+/**
+ * @brief Accesses the value at a position.
+ *
+ * The reference is invalidated by adding a value, which may remap the file.
+ *
+ * @param index The position, negative positions count from the end.
+ * @return A reference to the value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A>
+A &mapped_linked_list<A>::operator[](const int64_t &index)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
+
+    if (this->isempty())
+        throw INDEX_ERROR("Indexing an Empty List");
+
+    if (index < -(int64_t)(this->meta->length) || index >= (int64_t)(this->meta->length))
+        throw INDEX_ERROR("List index out of range");
+
+    return this->nodes[this->getslot(index)].value;
+}
+
+/**
+ * @brief Accesses the value at a position of a const list.
+ * @param index The position, negative positions count from the end.
+ * @return A const reference to the value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A>
+const A &mapped_linked_list<A>::operator[](const int64_t &index) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
+
+    if (this->isempty())
+        throw INDEX_ERROR("Indexing an Empty List");
+
+    if (index < -(int64_t)(this->meta->length) || index >= (int64_t)(this->meta->length))
+        throw INDEX_ERROR("List index out of range");
+
+    return this->nodes[this->getslot(index)].value;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::operator>(const mapped_linked_list<A> &obj) const
+{
+    return obj < *this;
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than another.
+ * @param obj The list to compare with.
+ * @return true if this list is less, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::operator<(const mapped_linked_list<A> &obj) const
+{
+    uint64_t left = this->meta->head, right = obj.meta->head;
+    while (left != nil && right != nil)
+    {
+        if (this->nodes[left].value < obj.nodes[right].value)
+            return true;
+        if (obj.nodes[right].value < this->nodes[left].value)
+            return false;
+        left = this->nodes[left].next;
+        right = obj.nodes[right].next;
+    }
+
+    return left == nil && right != nil;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater or equal, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::operator>=(const mapped_linked_list<A> &obj) const
+{
+    return !(*this < obj);
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is less or equal, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::operator<=(const mapped_linked_list<A> &obj) const
+{
+    return !(obj < *this);
+}
+
+/**
+ * @brief Checks if two lists hold the same values in the same order.
+ * @param obj The list to compare with.
+ * @return true if the lists are equal, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::operator==(const mapped_linked_list<A> &obj) const
+{
+    if (this->meta->length != obj.meta->length)
+        return false;
+
+    uint64_t left = this->meta->head, right = obj.meta->head;
+    while (left != nil)
+    {
+        if (!(this->nodes[left].value == obj.nodes[right].value))
+            return false;
+        left = this->nodes[left].next;
+        right = obj.nodes[right].next;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks if two lists differ.
+ * @param obj The list to compare with.
+ * @return true if the lists are not equal, otherwise false.
+ */
+template <typename A>
+bool mapped_linked_list<A>::operator!=(const mapped_linked_list<A> &obj) const
+{
+    return !(*this == obj);
+}
+
+/**
+ * @brief Converts the list to a vector.
+ * @return A vector holding the values in order.
+ */
+template <typename A>
+mapped_linked_list<A>::operator std::vector<A>() const
+{
+    std::vector<A> values;
+    values.reserve(this->meta->length);
+    for (uint64_t ptr = this->meta->head; ptr != nil; ptr = this->nodes[ptr].next)
+        values.push_back(this->nodes[ptr].value);
+
+    return values;
+}
+
+/**
+ * @brief Converts the list to a string.
+ * @return The list formatted as by `operator<<`.
+ */
+template <typename A>
+std::string mapped_linked_list<A>::to_string() const
+{
+    std::ostringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+/**
+ * @brief Prints the list to the standard output.
+ */
+template <typename A>
+void mapped_linked_list<A>::show() const
+{
+    std::cout << *this;
+}
+
+/**
+ * @brief Removes every value and shrinks the file to its header.
+ */
+template <typename A>
+void mapped_linked_list<A>::clear()
+{
+    this->meta->head = this->meta->tail = this->meta->unused = nil;
+    this->meta->length = this->meta->used = 0;
+    this->resize(0);
+}
+
+/**
+ * @brief Get an iterator to the first value.
+ * @return An iterator to the head of the list.
+ */
+template <typename A>
+typename mapped_linked_list<A>::iterator mapped_linked_list<A>::begin()
+{
+    return iterator(this, this->meta->head);
+}
+
+/**
+ * @brief Get an iterator past the last value.
+ * @return An iterator to the end of the list.
+ */
+template <typename A>
+typename mapped_linked_list<A>::iterator mapped_linked_list<A>::end()
+{
+    return iterator(this, nil);
+}
+
+/**
+ * @brief Get a const_iterator to the first value of a const list.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A>
+typename mapped_linked_list<A>::const_iterator mapped_linked_list<A>::begin() const
+{
+    return const_iterator(this, this->meta->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value of a const list.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A>
+typename mapped_linked_list<A>::const_iterator mapped_linked_list<A>::end() const
+{
+    return const_iterator(this, nil);
+}
+
+/**
+ * @brief Get a const_iterator to the first value.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A>
+typename mapped_linked_list<A>::const_iterator mapped_linked_list<A>::cbegin() const
+{
+    return const_iterator(this, this->meta->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A>
+typename mapped_linked_list<A>::const_iterator mapped_linked_list<A>::cend() const
+{
+    return const_iterator(this, nil);
+}
+
+/**
+ * @brief Unmaps and closes the file.
+ *
+ * The system still writes the changes back to the file, but only sync() waits for it.
+ */
+template <typename A>
+mapped_linked_list<A>::~mapped_linked_list()
+{
+    this->unmap();
+    if (this->fd >= 0)
+        ::close(this->fd);
+}
+
+/**
+ * @brief Finds the minimum value of a mapped linked list.
+ * @param obj The list to search.
+ * @return The minimum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A>
+A min(const mapped_linked_list<A> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding min in Empty List");
+
+    A min_value = obj.nodes[obj.meta->head].value;
+    for (uint64_t ptr = obj.nodes[obj.meta->head].next; ptr != mapped_linked_list<A>::nil; ptr = obj.nodes[ptr].next)
+        if (obj.nodes[ptr].value < min_value)
+            min_value = obj.nodes[ptr].value;
+
+    return min_value;
+}
+
+/**
+ * @brief Finds the maximum value of a mapped linked list.
+ * @param obj The list to search.
+ * @return The maximum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A>
+A max(const mapped_linked_list<A> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding max in Empty List");
+
+    A max_value = obj.nodes[obj.meta->head].value;
+    for (uint64_t ptr = obj.nodes[obj.meta->head].next; ptr != mapped_linked_list<A>::nil; ptr = obj.nodes[ptr].next)
+        if (obj.nodes[ptr].value > max_value)
+            max_value = obj.nodes[ptr].value;
+
+    return max_value;
+}
+
+/**
+ * @brief Returns the number of values in a mapped linked list.
+ * @param obj The list.
+ * @return The number of values.
+ */
+template <typename A>
+size_t len(const mapped_linked_list<A> &obj)
+{
+    return obj.size();
+}
+
+/**
+ * @brief Outputs the mapped linked list to an output stream.
+ * @param out The output stream to which the list will be written.
+ * @param obj The list to be printed.
+ * @return The output stream with the list data.
+ */
+template <typename A>
+std::ostream &operator<<(std::ostream &out, const mapped_linked_list<A> &obj)
+{
+    out << "[";
+
+    for (uint64_t ptr = obj.meta->head; ptr != mapped_linked_list<A>::nil; ptr = obj.nodes[ptr].next)
+    {
+        out << obj.nodes[ptr].value;
+        if (obj.nodes[ptr].next != mapped_linked_list<A>::nil)
+            out << ", ";
+    }
+
+    out << "]";
+
+    return out;
+}
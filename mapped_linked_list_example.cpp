@@ -0,0 +1,44 @@
+#include <cstdio>
+#include <iostream>
+
+#include "mapped_linked_list.hpp"
+
+/**
+ * @file mapped_linked_list_example.cpp
+ * @brief Demonstrates a linked list that persists in a memory-mapped file.
+ *
+ * This program fills a mapped linked list, syncs it to its file and closes it,
+ * then opens the file again and keeps working on the same list.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    const std::string path = "readings.list";
+    std::remove(path.c_str());
+
+    {
+        mapped_linked_list<double> readings(path);
+        readings.extend({21.5, 22.0, 19.75});
+        readings.insert_in_order(20.25);
+        readings.sync(); // Waits until the list is on disk
+    } // The file is unmapped and closed here
+
+    mapped_linked_list<double> readings(path); // Maps the file; nothing is read yet
+    std::cout << "reopened: " << readings << std::endl; // reopened: [20.25, 21.5, 22, 19.75]
+
+    readings.sort();
+    readings.pop(0);
+    std::cout << "sorted, lowest removed: " << readings << std::endl; // sorted, lowest removed: [20.25, 21.5, 22]
+    std::cout << "max: " << max(readings) << ", size: " << len(readings) << std::endl; // max: 22, size: 3
+
+    readings.compact(); // Shrinks the file to the values it holds
+    std::cout << "file holds " << readings.capacity() << " slots" << std::endl; // file holds 3 slots
+
+    std::remove(path.c_str());
+
+    return 0;
+}
@@ -85,6 +85,16 @@ int main()
     std::cout << "list1: " << list1 << std::endl; // list1: [1, 10, 5, 4, 5]
     std::cout << "list2: " << list2 << std::endl; // list2: [1, 10, 5, 4, 5]
 
+    // A hash cached by hash() does not decide equality, so a value written
+    // through a reference obtained earlier is still compared
+    singly_linked_list<int> list4 = {1,2,3};
+    singly_linked_list<int> list5 = {9,2,3};
+    int &first = list4[0];
+    list4.hash();
+    list5.hash();
+    first = 9;
+    std::cout << "list4 == list5: " << (list4 == list5) << std::endl; // list4 == list5: true
+
     // Demonstrate IndexError
     try 
     {
@@ -0,0 +1,177 @@
+#if __cplusplus >= 201103L
+
+#ifndef PERSISTENT_LINKED_LIST_H
+#define PERSISTENT_LINKED_LIST_H
+
+#include "./linkedlist.hpp"
+
+/**
+ * @brief An immutable singly linked list whose versions share their nodes.
+ *
+ * A list never changes once built. `prepend`, `tail`, `insert` and `pop` return
+ * a new version that shares the unchanged suffix of the old one. This makes
+ * `prepend`, `tail` and `pop(0)` O(1). A change at position `i` copies only the
+ * `i` nodes in front of it. Copying a list is O(1). Nodes are reference-counted
+ * and freed when the last version using them is destroyed.
+ *
+ * The counts are not atomic, so versions that share nodes must not be copied
+ * or destroyed concurrently from different threads.
+ *
+ * @tparam A The value type.
+ * @tparam Allocator The allocator nodes are obtained from. Versions share nodes
+ *         only while their allocators compare equal.
+ */
+template <typename A, typename Allocator = std::allocator<A>>
+class persistent_linked_list final
+{
+    private:
+        typedef struct node
+        {
+            A value;
+            struct node *next;
+            size_t ref_count;
+        } node;
+
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<node> node_allocator;
+        typedef std::allocator_traits<node_allocator> node_traits;
+
+        Allocator alloc;
+        node *head;
+        size_t length;
+
+        node *acquire(const A &value, node *next) const;
+        static node *retain(node *ptr);
+        void release();
+
+        const node *getnode(const int64_t &index) const;
+        persistent_linked_list<A, Allocator> rebuild(const size_t &count, const A *value, const size_t &skip) const;
+    public:
+        typedef A value_type;
+        typedef Allocator allocator_type;
+
+        class const_iterator
+        {
+            private:
+                const node *ptr;
+
+                const_iterator(const node *ptr);
+
+                friend class persistent_linked_list<A, Allocator>;
+            public:
+                typedef std::forward_iterator_tag iterator_category;
+                typedef A value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef const A *pointer;
+                typedef const A &reference;
+
+                const_iterator();
+
+                const_iterator &operator++();
+                const_iterator operator++(int);
+                const A &operator*() const;
+                const A *operator->() const;
+                bool operator==(const const_iterator &it) const;
+                bool operator!=(const const_iterator &it) const;
+
+                ~const_iterator() = default;
+        };
+
+        typedef const_iterator iterator;
+
+        persistent_linked_list();
+        explicit persistent_linked_list(const Allocator &alloc);
+
+        persistent_linked_list(persistent_linked_list<A, Allocator> &&obj);
+        persistent_linked_list(const persistent_linked_list<A, Allocator> &obj);
+        persistent_linked_list(const std::initializer_list<A> &values, const Allocator &alloc = Allocator());
+
+        template <size_t N>
+        persistent_linked_list(const A (&array)[N], const Allocator &alloc = Allocator());
+        persistent_linked_list(const std::vector<A> &values, const Allocator &alloc = Allocator());
+        explicit persistent_linked_list(const linkedlist<A, Allocator> &obj);
+
+        template <typename Iterator>
+        persistent_linked_list(Iterator first, Iterator last, const Allocator &alloc = Allocator());
+
+        persistent_linked_list<A, Allocator> &operator=(persistent_linked_list<A, Allocator> &&obj);
+        persistent_linked_list<A, Allocator> &operator=(const persistent_linked_list<A, Allocator> &obj);
+
+        persistent_linked_list<A, Allocator> prepend(const A &value) const;
+        persistent_linked_list<A, Allocator> insert(const int64_t &index, const A &value) const;
+        persistent_linked_list<A, Allocator> pop(const int64_t &index) const;
+        persistent_linked_list<A, Allocator> tail() const;
+
+        const A &front() const;
+
+        size_t size() const;
+        bool isempty() const;
+
+        bool contains(const A &value) const;
+        int64_t index(const A &value) const;
+        size_t count(const A &value) const;
+        bool try_index(const A &value, size_t &index) const;
+
+        const A &operator[](const int64_t &index) const;
+        const A *try_at(const int64_t &index) const;
+
+        bool operator>(const persistent_linked_list<A, Allocator> &obj) const;
+        bool operator<(const persistent_linked_list<A, Allocator> &obj) const;
+        bool operator>=(const persistent_linked_list<A, Allocator> &obj) const;
+        bool operator<=(const persistent_linked_list<A, Allocator> &obj) const;
+        bool operator==(const persistent_linked_list<A, Allocator> &obj) const;
+        bool operator!=(const persistent_linked_list<A, Allocator> &obj) const;
+
+        operator std::vector<A>() const;
+
+        std::string to_string() const;
+        void show() const;
+
+        allocator_type get_allocator() const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        template <typename B, typename C>
+        friend B min(const persistent_linked_list<B, C> &obj);
+
+        template <typename B, typename C>
+        friend B max(const persistent_linked_list<B, C> &obj);
+
+        template <typename B, typename C>
+        friend std::ostream &operator<<(std::ostream &out, const persistent_linked_list<B, C> &obj);
+
+        ~persistent_linked_list();
+};
+
+template <typename A, typename Allocator>
+A min(const persistent_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+A max(const persistent_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+size_t len(const persistent_linked_list<A, Allocator> &obj);
+
+template <typename A, typename Allocator>
+std::ostream &operator<<(std::ostream &out, const persistent_linked_list<A, Allocator> &obj);
+
+#if __cplusplus >= 201703L && defined(__has_include)
+    #if __has_include(<memory_resource>)
+        namespace pmr
+        {
+            template <typename A>
+            using persistent_linked_list = ::persistent_linked_list<A, std::pmr::polymorphic_allocator<A>>;
+        }
+    #endif
+#endif
+
+#include "./persistent_linked_list.tpp"
+
+#endif
+
+#else
+    #error "Requires C++11 or later.\n"
+
+#endif
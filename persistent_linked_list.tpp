@@ -0,0 +1,854 @@
+#include "./persistent_linked_list.hpp"
+
+
+/**
+ * @brief Default constructor for the const_iterator.
+ *
+ * Initializes a const_iterator that points past the end of no list.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::const_iterator::const_iterator():
+    ptr(nullptr) {}
+
+/**
+ * @brief Constructor for the const_iterator.
+ * @param ptr The node the const_iterator will point to, nullptr for the end.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::const_iterator::const_iterator(const node *ptr):
+    ptr(ptr) {}
+
+/**
+ * @brief Prefix increment operator for the const_iterator.
+ * @return A reference to the updated const_iterator.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::const_iterator &persistent_linked_list<A, Allocator>::const_iterator::operator++()
+{
+    this->ptr = this->ptr->next;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the const_iterator.
+ * @param int Dummy parameter to distinguish from the prefix increment.
+ * @return A copy of the const_iterator before incrementing.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::const_iterator persistent_linked_list<A, Allocator>::const_iterator::operator++(int)
+{
+    const_iterator it = *this;
+    this->ptr = this->ptr->next;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the const_iterator.
+ * @return A const reference to the value the const_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A &persistent_linked_list<A, Allocator>::const_iterator::operator*() const
+{
+    return this->ptr->value;
+}
+
+/**
+ * @brief Member access operator for the const_iterator.
+ * @return A pointer to the value the const_iterator points to.
+ */
+template <typename A, typename Allocator>
+const A *persistent_linked_list<A, Allocator>::const_iterator::operator->() const
+{
+    return &this->ptr->value;
+}
+
+/**
+ * @brief Equality operator for the const_iterator.
+ * @param it The const_iterator to compare with.
+ * @return true If both const_iterators point to the same node, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::const_iterator::operator==(const const_iterator &it) const
+{
+    return this->ptr == it.ptr;
+}
+
+/**
+ * @brief Inequality operator for the const_iterator.
+ * @param it The const_iterator to compare with.
+ * @return true If the const_iterators point to different nodes, false otherwise.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::const_iterator::operator!=(const const_iterator &it) const
+{
+    return this->ptr != it.ptr;
+}
+
+/**
+ * @brief Allocates a node holding a value, with a count of one.
+ *
+ * @param value The value of the node.
+ * @param next The node that follows, whose reference the new node takes over.
+ * @return The new node.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::node *persistent_linked_list<A, Allocator>::acquire(const A &value, node *next) const
+{
+    node_allocator alloc(this->alloc);
+    node *ptr = node_traits::allocate(alloc, 1);
+    try
+    {
+        node_traits::construct(alloc, ptr);
+        ptr->value = value;
+    }
+    catch (...)
+    {
+        node_traits::deallocate(alloc, ptr, 1);
+        throw;
+    }
+    LINKEDLIST_STAT_ALLOC();
+
+    ptr->next = next;
+    ptr->ref_count = 1;
+
+    return ptr;
+}
+
+/**
+ * @brief Adds a reference to a node.
+ * @param ptr The node, nullptr is ignored.
+ * @return `ptr`.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::node *persistent_linked_list<A, Allocator>::retain(node *ptr)
+{
+    if (ptr != nullptr)
+        ptr->ref_count++;
+
+    return ptr;
+}
+
+/**
+ * @brief Drops this version's reference to its nodes and empties it.
+ *
+ * Nodes are freed front to back until one is reached that another version
+ * still uses, without recursion, so long lists cannot overflow the stack.
+ */
+template <typename A, typename Allocator>
+void persistent_linked_list<A, Allocator>::release()
+{
+    node_allocator alloc(this->alloc);
+    node *ptr = this->head;
+    while (ptr != nullptr && --(ptr->ref_count) == 0)
+    {
+        node *next = ptr->next;
+        node_traits::destroy(alloc, ptr);
+        node_traits::deallocate(alloc, ptr, 1);
+        LINKEDLIST_STAT_FREE();
+        ptr = next;
+    }
+
+    this->head = nullptr;
+    this->length = 0;
+}
+
+/**
+ * @brief Locates the node at a specific index.
+ *
+ * @param index A valid index into the list, negative indices count from the end.
+ * @return The node at the specified index.
+ */
+template <typename A, typename Allocator>
+const typename persistent_linked_list<A, Allocator>::node *persistent_linked_list<A, Allocator>::getnode(const int64_t &index) const
+{
+    size_t position = (index < 0L) ? (size_t)(index + (int64_t)this->length) : (size_t)index;
+
+    const node *ptr = this->head;
+    for (size_t i = 0; i < position; i++)
+        ptr = ptr->next;
+    LINKEDLIST_STAT_HOPS(position);
+
+    return ptr;
+}
+
+/**
+ * @brief Builds a version that differs from this one at a single position.
+ *
+ * The first `count` values are copied, optionally followed by a new value.
+ * Then `skip` nodes are dropped and the rest of this version is shared.
+ * Only the nodes in front of the change are walked.
+ *
+ * @param count The number of leading values to copy.
+ * @param value The value to insert after the copies, or nullptr for none.
+ * @param skip The number of nodes after the copies to leave out.
+ * @return The new version.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> persistent_linked_list<A, Allocator>::rebuild(const size_t &count, const A *value, const size_t &skip) const
+{
+    // The partial chain stays owned by the result, so it is freed if a copy throws
+    persistent_linked_list<A, Allocator> result(this->alloc);
+    node **link = &result.head;
+
+    node *ptr = this->head;
+    for (size_t i = 0; i < count; i++)
+    {
+        *link = this->acquire(ptr->value, nullptr);
+        link = &(*link)->next;
+        ptr = ptr->next;
+    }
+
+    if (value != nullptr)
+    {
+        *link = this->acquire(*value, nullptr);
+        link = &(*link)->next;
+    }
+
+    for (size_t i = 0; i < skip; i++)
+        ptr = ptr->next;
+    LINKEDLIST_STAT_HOPS(count + skip);
+
+    *link = persistent_linked_list<A, Allocator>::retain(ptr);
+    result.length = this->length - skip + ((value != nullptr) ? 1 : 0);
+
+    return result;
+}
+
+/**
+ * @brief Constructor for an empty persistent_linked_list.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list():
+    alloc(), head(nullptr), length(0) {}
+
+/**
+ * @brief Constructor for an empty persistent_linked_list using a given allocator.
+ * @param alloc The allocator the nodes are obtained from.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(const Allocator &alloc):
+    alloc(alloc), head(nullptr), length(0) {}
+
+/**
+ * @brief Move constructor, leaving `obj` empty.
+ * @param obj The list to move from.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(persistent_linked_list<A, Allocator> &&obj):
+    alloc(obj.alloc), head(obj.head), length(obj.length)
+{
+    obj.head = nullptr;
+    obj.length = 0;
+}
+
+/**
+ * @brief Copy constructor, sharing every node of `obj` in O(1).
+ * @param obj The list to copy.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(const persistent_linked_list<A, Allocator> &obj):
+    alloc(obj.alloc), head(persistent_linked_list<A, Allocator>::retain(obj.head)), length(obj.length) {}
+
+/**
+ * @brief Constructor from an initializer list.
+ * @param values The values of the list, in order.
+ * @param alloc The allocator the nodes are obtained from.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(const std::initializer_list<A> &values, const Allocator &alloc):
+    persistent_linked_list(values.begin(), values.end(), alloc) {}
+
+/**
+ * @brief Constructor from a C-style array.
+ * @param array The values of the list, in order.
+ * @param alloc The allocator the nodes are obtained from.
+ */
+template <typename A, typename Allocator>
+template <size_t N>
+persistent_linked_list<A, Allocator>::persistent_linked_list(const A (&array)[N], const Allocator &alloc):
+    persistent_linked_list(array, array + N, alloc) {}
+
+/**
+ * @brief Constructor from a vector.
+ * @param values The values of the list, in order.
+ * @param alloc The allocator the nodes are obtained from.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(const std::vector<A> &values, const Allocator &alloc):
+    persistent_linked_list(values.begin(), values.end(), alloc) {}
+
+/**
+ * @brief Takes a snapshot of a mutable list.
+ *
+ * The values are copied, so later changes to `obj` do not affect the snapshot.
+ *
+ * @param obj The list to copy.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(const linkedlist<A, Allocator> &obj):
+    persistent_linked_list(obj.cbegin(), obj.cend(), obj.get_allocator()) {}
+
+/**
+ * @brief Constructor from a range of values.
+ *
+ * @tparam Iterator An input iterator over values convertible to A.
+ * @param first The beginning of the range.
+ * @param last The end of the range.
+ * @param alloc The allocator the nodes are obtained from.
+ */
+template <typename A, typename Allocator>
+template <typename Iterator>
+persistent_linked_list<A, Allocator>::persistent_linked_list(Iterator first, Iterator last, const Allocator &alloc):
+    alloc(alloc), head(nullptr), length(0)
+{
+    node **link = &this->head;
+    try
+    {
+        for (; first != last; ++first)
+        {
+            *link = this->acquire(*first, nullptr);
+            link = &(*link)->next;
+            this->length++;
+        }
+    }
+    catch (...)
+    {
+        this->release();
+        throw;
+    }
+}
+
+/**
+ * @brief Move assignment operator.
+ *
+ * The nodes of `obj` are taken over when the allocators compare equal, and
+ * copied otherwise.
+ *
+ * @param obj The list to move from.
+ * @return A reference to this list.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> &persistent_linked_list<A, Allocator>::operator=(persistent_linked_list<A, Allocator> &&obj)
+{
+    if (this == &obj)
+        return *this;
+
+    if (!(this->alloc == obj.alloc))
+        return *this = static_cast<const persistent_linked_list<A, Allocator> &>(obj);
+
+    this->release();
+    this->head = obj.head;
+    this->length = obj.length;
+    obj.head = nullptr;
+    obj.length = 0;
+
+    return *this;
+}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * The nodes of `obj` are shared in O(1) when the allocators compare equal,
+ * and copied otherwise.
+ *
+ * @param obj The list to copy.
+ * @return A reference to this list.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> &persistent_linked_list<A, Allocator>::operator=(const persistent_linked_list<A, Allocator> &obj)
+{
+    if (this->head == obj.head)
+        return *this;
+
+    if (!(this->alloc == obj.alloc))
+    {
+        persistent_linked_list<A, Allocator> copied(obj.begin(), obj.end(), this->alloc);
+        return *this = std::move(copied);
+    }
+
+    node *head = persistent_linked_list<A, Allocator>::retain(obj.head);
+    this->release();
+    this->head = head;
+    this->length = obj.length;
+
+    return *this;
+}
+
+/**
+ * @brief Returns a version with a value added to the front, in O(1).
+ * @param value The value to prepend.
+ * @return The new version, which shares every node of this one.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> persistent_linked_list<A, Allocator>::prepend(const A &value) const
+{
+    return this->rebuild(0, &value, 0);
+}
+
+/**
+ * @brief Returns a version with a value inserted at a specific index.
+ *
+ * The value ends up at `index`. Negative indices count from the end and
+ * indices past either end are clamped, as for Python's `list.insert`. The
+ * nodes before `index` are copied and the rest are shared.
+ *
+ * @param index The position at which to insert the value.
+ * @param value The value to insert.
+ * @return The new version.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> persistent_linked_list<A, Allocator>::insert(const int64_t &index, const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert);
+
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+    position = std::max(0L, std::min(position, (int64_t)this->length));
+
+    return this->rebuild((size_t)position, &value, 0);
+}
+
+/**
+ * @brief Returns a version without the value at a specific index.
+ *
+ * The nodes before `index` are copied and the rest are shared, so `pop(0)`
+ * is O(1).
+ *
+ * @param index The position of the value to remove, negative indices count from the end.
+ * @return The new version.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> persistent_linked_list<A, Allocator>::pop(const int64_t &index) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR(this->isempty() ? "Pop from Empty List" : "Pop index out of range");
+
+    size_t position = (index < 0L) ? (size_t)(index + (int64_t)this->length) : (size_t)index;
+
+    return this->rebuild(position, nullptr, 1);
+}
+
+/**
+ * @brief Returns the version without its first value, in O(1).
+ * @return The new version, which shares every remaining node of this one.
+ * @throws INDEX_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator> persistent_linked_list<A, Allocator>::tail() const
+{
+    if (this->isempty())
+        throw INDEX_ERROR("Tail of Empty List");
+
+    return this->rebuild(0, nullptr, 1);
+}
+
+/**
+ * @brief Returns the first value.
+ * @return A const reference to the first value.
+ * @throws INDEX_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+const A &persistent_linked_list<A, Allocator>::front() const
+{
+    if (this->isempty())
+        throw INDEX_ERROR("Front of Empty List");
+
+    return this->head->value;
+}
+
+/**
+ * @brief Returns the number of values in the list.
+ * @return The length of the list.
+ */
+template <typename A, typename Allocator>
+size_t persistent_linked_list<A, Allocator>::size() const
+{
+    return this->length;
+}
+
+/**
+ * @brief Checks if the list is empty.
+ * @return true if the list holds no values, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::isempty() const
+{
+    return this->head == nullptr;
+}
+
+/**
+ * @brief Checks if the list contains a value.
+ * @param value The value to search for.
+ * @return true if the value is found, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::contains(const A &value) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::contains);
+
+    size_t position;
+    return this->try_index(value, position);
+}
+
+/**
+ * @brief Returns the position of the first occurrence of a value.
+ * @param value The value to search for.
+ * @return The position of the value.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A, typename Allocator>
+int64_t persistent_linked_list<A, Allocator>::index(const A &value) const
+{
+    size_t position;
+    if (this->try_index(value, position))
+        return (int64_t)position;
+
+    throw VALUE_ERROR(this->isempty() ? "Index of Element from Empty List" : "Value `x` not in List");
+}
+
+/**
+ * @brief Counts the occurrences of a value.
+ * @param value The value to count.
+ * @return The number of occurrences.
+ */
+template <typename A, typename Allocator>
+size_t persistent_linked_list<A, Allocator>::count(const A &value) const
+{
+    size_t founds = 0;
+    for (const node *ptr = this->head; ptr != nullptr; ptr = ptr->next)
+        if (ptr->value == value)
+            founds++;
+    LINKEDLIST_STAT_HOPS(this->length);
+
+    return founds;
+}
+
+/**
+ * @brief Finds the position of the first occurrence of a value, without throwing.
+ * @param value The value to search for.
+ * @param index Set to the position of the value when it is found.
+ * @return true if the value is found, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::try_index(const A &value, size_t &index) const
+{
+    size_t position = 0;
+    for (const node *ptr = this->head; ptr != nullptr; ptr = ptr->next, position++)
+    {
+        if (ptr->value == value)
+        {
+            LINKEDLIST_STAT_HOPS(position);
+            index = position;
+            return true;
+        }
+    }
+    LINKEDLIST_STAT_HOPS(position);
+
+    return false;
+}
+
+/**
+ * @brief Accesses the value at a specific index.
+ * @param index The position of the value, negative indices count from the end.
+ * @return A const reference to the value.
+ * @throws INDEX_ERROR If the index is out of range.
+ */
+template <typename A, typename Allocator>
+const A &persistent_linked_list<A, Allocator>::operator[](const int64_t &index) const
+{
+    const A *value = this->try_at(index);
+    if (value == nullptr)
+        throw INDEX_ERROR("List index out of range");
+
+    return *value;
+}
+
+/**
+ * @brief Accesses the value at a specific index, without throwing.
+ * @param index The position of the value, negative indices count from the end.
+ * @return A pointer to the value, or nullptr if the index is out of range.
+ */
+template <typename A, typename Allocator>
+const A *persistent_linked_list<A, Allocator>::try_at(const int64_t &index) const
+{
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        return nullptr;
+
+    return &this->getnode(index)->value;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::operator>(const persistent_linked_list<A, Allocator> &obj) const
+{
+    return obj < *this;
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than another.
+ *
+ * The walk stops at the first node both lists share, since the rest of
+ * both lists is the same from there on.
+ *
+ * @param obj The list to compare with.
+ * @return true if this list is less, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::operator<(const persistent_linked_list<A, Allocator> &obj) const
+{
+    const node *left = this->head, *right = obj.head;
+    while (left != nullptr && right != nullptr)
+    {
+        if (left == right)
+            return false;
+        if (left->value < right->value)
+            return true;
+        if (right->value < left->value)
+            return false;
+        left = left->next;
+        right = right->next;
+    }
+
+    return left == nullptr && right != nullptr;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater or equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::operator>=(const persistent_linked_list<A, Allocator> &obj) const
+{
+    return !(*this < obj);
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is less or equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::operator<=(const persistent_linked_list<A, Allocator> &obj) const
+{
+    return !(obj < *this);
+}
+
+/**
+ * @brief Checks if two lists hold the same values in the same order.
+ *
+ * The walk stops at the first node both lists share, so comparing two
+ * versions of one list only looks at the nodes in front of their common suffix.
+ *
+ * @param obj The list to compare with.
+ * @return true if the lists are equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::operator==(const persistent_linked_list<A, Allocator> &obj) const
+{
+    if (this->length != obj.length)
+        return false;
+
+    // Equal lengths keep both walks the same distance from the end
+    const node *left = this->head, *right = obj.head;
+    while (left != right)
+    {
+        if (!(left->value == right->value))
+            return false;
+        left = left->next;
+        right = right->next;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks if two lists differ.
+ * @param obj The list to compare with.
+ * @return true if the lists are not equal, otherwise false.
+ */
+template <typename A, typename Allocator>
+bool persistent_linked_list<A, Allocator>::operator!=(const persistent_linked_list<A, Allocator> &obj) const
+{
+    return !(*this == obj);
+}
+
+/**
+ * @brief Converts the list to a vector.
+ * @return A vector holding the values in order.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::operator std::vector<A>() const
+{
+    std::vector<A> values;
+    values.reserve(this->length);
+    for (const node *ptr = this->head; ptr != nullptr; ptr = ptr->next)
+        values.push_back(ptr->value);
+
+    return values;
+}
+
+/**
+ * @brief Converts the list to a string.
+ * @return The list formatted as by `operator<<`.
+ */
+template <typename A, typename Allocator>
+std::string persistent_linked_list<A, Allocator>::to_string() const
+{
+    std::ostringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+/**
+ * @brief Prints the list to the standard output.
+ */
+template <typename A, typename Allocator>
+void persistent_linked_list<A, Allocator>::show() const
+{
+    std::cout << *this;
+}
+
+/**
+ * @brief Returns the allocator the nodes are obtained from.
+ * @return A copy of the allocator.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::allocator_type persistent_linked_list<A, Allocator>::get_allocator() const
+{
+    return this->alloc;
+}
+
+/**
+ * @brief Get a const_iterator to the first value.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::const_iterator persistent_linked_list<A, Allocator>::begin() const
+{
+    return const_iterator(this->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::const_iterator persistent_linked_list<A, Allocator>::end() const
+{
+    return const_iterator(nullptr);
+}
+
+/**
+ * @brief Get a const_iterator to the first value.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::const_iterator persistent_linked_list<A, Allocator>::cbegin() const
+{
+    return const_iterator(this->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A, typename Allocator>
+typename persistent_linked_list<A, Allocator>::const_iterator persistent_linked_list<A, Allocator>::cend() const
+{
+    return const_iterator(nullptr);
+}
+
+/**
+ * @brief Destructor, freeing the nodes no other version uses.
+ */
+template <typename A, typename Allocator>
+persistent_linked_list<A, Allocator>::~persistent_linked_list()
+{
+    this->release();
+}
+
+/**
+ * @brief Finds the minimum value in the list.
+ * @param obj The list to search.
+ * @return The minimum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+A min(const persistent_linked_list<A, Allocator> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding min in Empty List");
+
+    A min_value = obj.head->value;
+    for (const typename persistent_linked_list<A, Allocator>::node *ptr = obj.head->next; ptr != nullptr; ptr = ptr->next)
+        if (ptr->value < min_value)
+            min_value = ptr->value;
+
+    return min_value;
+}
+
+/**
+ * @brief Finds the maximum value in the list.
+ * @param obj The list to search.
+ * @return The maximum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A, typename Allocator>
+A max(const persistent_linked_list<A, Allocator> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding max in Empty List");
+
+    A max_value = obj.head->value;
+    for (const typename persistent_linked_list<A, Allocator>::node *ptr = obj.head->next; ptr != nullptr; ptr = ptr->next)
+        if (max_value < ptr->value)
+            max_value = ptr->value;
+
+    return max_value;
+}
+
+/**
+ * @brief Returns the number of values in the list.
+ * @param obj The list.
+ * @return The length of the list.
+ */
+template <typename A, typename Allocator>
+size_t len(const persistent_linked_list<A, Allocator> &obj)
+{
+    return obj.size();
+}
+
+/**
+ * @brief Writes the list to an output stream as `[a, b, c]`.
+ * @param out The stream to write to.
+ * @param obj The list to write.
+ * @return The stream.
+ */
+template <typename A, typename Allocator>
+std::ostream &operator<<(std::ostream &out, const persistent_linked_list<A, Allocator> &obj)
+{
+    out << "[";
+
+    for (const typename persistent_linked_list<A, Allocator>::node *ptr = obj.head; ptr != nullptr; ptr = ptr->next)
+    {
+        out << ptr->value;
+        if (ptr->next != nullptr)
+            out << ", ";
+    }
+
+    out << "]";
+
+    return out;
+}
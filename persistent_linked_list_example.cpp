@@ -0,0 +1,46 @@
+#include <iostream>
+#include <vector>
+
+#include "persistent_linked_list.hpp"
+
+/**
+ * @file persistent_linked_list_example.cpp
+ * @brief Demonstrates versions of a persistent linked list sharing their nodes.
+ *
+ * Every change returns a new version and leaves the old one intact, so an undo
+ * history is just a vector of versions. Versions share the nodes they have in
+ * common instead of copying them.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    persistent_linked_list<int> list1 = {3, 4, 5};
+
+    // Each edit keeps the previous version for undo
+    std::vector<persistent_linked_list<int>> history;
+    history.push_back(list1);
+    history.push_back(history.back().prepend(2)); // O(1)
+    history.push_back(history.back().prepend(1)); // O(1)
+    history.push_back(history.back().pop(2));     // copies the two nodes in front
+
+    for (const persistent_linked_list<int> &version : history)
+        std::cout << version << std::endl; // [3, 4, 5], [2, 3, 4, 5], [1, 2, 3, 4, 5], [1, 2, 4, 5]
+
+    // Undo the last edit
+    history.pop_back();
+    std::cout << "current: " << history.back() << std::endl; // current: [1, 2, 3, 4, 5]
+
+    // tail() drops the first value without copying anything
+    persistent_linked_list<int> list2 = history.back().tail().tail();
+    std::cout << "list2 == list1: " << (list2 == list1) << std::endl; // list2 == list1: 1
+
+    // Read-only queries work as on the other lists
+    std::cout << "contains 4: " << list2.contains(4) << std::endl; // contains 4: 1
+    std::cout << "max: " << max(list2) << std::endl;                // max: 5
+
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <iostream>
+
+#include "singly_linked_list.hpp"
+
+/**
+ * @file pop_example.cpp
+ * @brief Demonstrates `pop` and the non-throwing `try_*` lookups in singly linked list.
+ *
+ * `pop`, `operator[]`, `index` and `remove` throw `IndexError` or `ValueError`
+ * on a miss. Where a miss is a normal outcome, `try_pop`, `try_at`, `try_index`
+ * and `try_remove` report it through their return value instead; they never
+ * throw or allocate themselves.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    singly_linked_list<int> list1 = {10, 20, 30, 40};
+
+    // Pop the last, the first and a negative index
+    std::cout << list1.pop() << std::endl;   // 40
+    std::cout << list1.pop(0) << std::endl;  // 10
+    std::cout << list1.pop(-1) << std::endl; // 30
+    std::cout << "list1: " << list1 << std::endl; // list1: [20]
+
+    // Out of range throws
+    try
+    {
+        list1.pop(5);
+    }
+    catch (const IndexError &)
+    {
+        std::cout << "IndexError caught" << std::endl;
+    }
+
+    // The try_* variants report misses through their return value
+    int value;
+    if (!list1.try_pop(5, value))
+        std::cout << "nothing at index 5" << std::endl; // nothing at index 5
+
+    size_t position;
+    if (list1.try_index(20, position))
+        std::cout << "20 is at " << position << std::endl; // 20 is at 0
+
+    if (int *element = list1.try_at(0))
+        *element = 25;
+
+    std::cout << "removed 99: " << list1.try_remove(99) << std::endl; // removed 99: 0
+
+    while (list1.try_pop(value))
+        std::cout << "popped " << value << std::endl; // popped 25
+
+    return 0;
+}
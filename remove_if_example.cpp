@@ -0,0 +1,45 @@
+#include <iostream>
+#include <string>
+
+#include "singly_linked_list.hpp"
+
+/**
+ * @file remove_if_example.cpp
+ * @brief Demonstrates bulk removal from a singly linked list.
+ *
+ * `remove_all`, `remove_if` and `erase` each remove any number of values in a
+ * single pass over the list and return how many were removed. Unlike `remove`,
+ * none of them throws when nothing matches.
+ *
+ * @sa remove_example.cpp for removing a single value.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    singly_linked_list<int> list1 = {4, 1, 4, 2, 4, 3};
+
+    // Remove every 4
+    size_t removed = list1.remove_all(4);
+    std::cout << "removed " << removed << ": " << list1 << std::endl; // removed 3: [1, 2, 3]
+
+    // Nothing to remove is not an error
+    std::cout << "removed " << list1.remove_all(100) << std::endl; // removed 0
+
+    // Remove by predicate, e.g. expired cache entries
+    singly_linked_list<std::string> keys = {"tmp_a", "user_1", "tmp_b", "user_2"};
+    keys.remove_if([](const std::string &key) { return key.compare(0, 4, "tmp_") == 0; });
+    std::cout << "keys: " << keys << std::endl; // keys: [user_1, user_2]
+
+    // Remove positions 1 up to, not including, 4; negative bounds count from the end
+    singly_linked_list<int> list2 = {0, 1, 2, 3, 4, 5, 6, 7};
+    list2.erase(1, 4);
+    std::cout << "list2: " << list2 << std::endl; // list2: [0, 4, 5, 6, 7]
+    list2.erase(-2, 100);
+    std::cout << "list2: " << list2 << std::endl; // list2: [0, 4, 5]
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <iostream>
+
+#include "singly_linked_list.hpp"
+
+/**
+ * @file set_operations_example.cpp
+ * @brief Demonstrates using sorted singly linked lists as ordered sets.
+ *
+ * `unique` drops adjacent duplicates, and the set operations merge two sorted
+ * lists in a single pass over each. Called on lvalues they return a new list;
+ * called on rvalues they reuse the nodes of both lists and leave them empty.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    singly_linked_list<int> list1;
+    list1.insert_in_order({5, 1, 3, 1, 7, 3});
+
+    // Drop the duplicates of a sorted list
+    size_t removed = list1.unique();
+    std::cout << "removed " << removed << ": " << list1 << std::endl; // removed 2: [1, 3, 5, 7]
+
+    singly_linked_list<int> list2 = {3, 4, 5, 6};
+
+    singly_linked_list<int> both = list1.set_union(list2);
+    singly_linked_list<int> common = list1.set_intersection(list2);
+    singly_linked_list<int> only1 = list1.set_difference(list2);
+    singly_linked_list<int> either = list1.set_symmetric_difference(list2);
+
+    std::cout << "union: " << both << std::endl;                   // union: [1, 3, 4, 5, 6, 7]
+    std::cout << "intersection: " << common << std::endl;          // intersection: [3, 5]
+    std::cout << "difference: " << only1 << std::endl;             // difference: [1, 7]
+    std::cout << "symmetric difference: " << either << std::endl;  // symmetric difference: [1, 4, 6, 7]
+
+    // Consume both lists instead of copying their values
+    singly_linked_list<int> merged = std::move(list1).set_union(std::move(list2));
+    std::cout << "merged: " << merged << ", list1: " << list1 << ", list2: " << list2 << std::endl; // merged: [1, 3, 4, 5, 6, 7], list1: [], list2: []
+
+    return 0;
+}
@@ -4,44 +4,144 @@
 #define SINGLY_LINKED_LIST_H
 
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <system_error>
+#include <thread>
 
 #include "./linkedlist.hpp"
+#include "./trace.hpp"
 
-template <typename A>
-class singly_linked_list: public linkedlist<A>
+/**
+ * @brief Slots for the first nodes of a singly_linked_list, kept inside the list object.
+ *
+ * One bit per slot marks the slots holding a node. With `N` = 0 the class is
+ * empty and takes no space in the list.
+ *
+ * @tparam Node The node type of the list.
+ * @tparam N The number of slots, at most 64.
+ */
+template <typename Node, size_t N>
+class inline_nodes
 {
+    static_assert(N <= 64, "At most 64 nodes can be kept inline");
+
     private:
-        size_t *length, *ref_count;
-        
-        static typename linkedlist<A>::node *mergesort(typename linkedlist<A>::node *head);
-        static typename linkedlist<A>::node *merge(typename linkedlist<A>::node *left, typename linkedlist<A>::node *right);
+        alignas(Node) mutable unsigned char slots[N * sizeof(Node)];
+        mutable uint64_t occupied;
+    protected:
+        inline_nodes();
+        inline_nodes(const inline_nodes<Node, N> &obj) = delete;
+        inline_nodes<Node, N> &operator=(const inline_nodes<Node, N> &obj) = delete;
+
+        Node *claim() const;
+        void vacate(const Node *ptr) const;
+        bool holds(const Node *ptr) const;
+        size_t occupancy() const;
+};
+
+template <typename Node>
+class inline_nodes<Node, 0>
+{
+    protected:
+        inline_nodes() = default;
+        inline_nodes(const inline_nodes<Node, 0> &obj) = delete;
+        inline_nodes<Node, 0> &operator=(const inline_nodes<Node, 0> &obj) = delete;
+
+        Node *claim() const;
+        void vacate(const Node *ptr) const;
+        bool holds(const Node *ptr) const;
+        size_t occupancy() const;
+};
+
+template <typename A, typename Allocator = std::allocator<A>, size_t Inline = 0>
+class singly_linked_list final: public linkedlist<A, Allocator>, public static_list<singly_linked_list<A, Allocator, Inline>>,
+                                private inline_nodes<typename linkedlist<A, Allocator>::node, Inline>
+{
+    private:
+        typedef struct settings
+        {
+            double compaction_threshold;
+            bool hash_tracking, order_tracking;
+            list_trace *trace;
+        } settings;
+
+        settings *options = nullptr;  // Opt-in behaviour of this object, allocated on first use
+
+        settings &configure();
+        void propagate_options(const Allocator &to);
+        bool tracks_hash() const override;
+        bool tracks_order() const;
+        list_trace *tracer() const;
+
+        typename linkedlist<A, Allocator>::node *alloc_node();
+        void free_node(typename linkedlist<A, Allocator>::node *ptr);
+        void relocate(singly_linked_list<A, Allocator, Inline> &obj);
+        void autocompact();
+        void append_parallel(const A *values, const size_t &count, size_t threads);
+        int64_t trace_position(const typename linkedlist<A, Allocator>::const_iterator &pos) const;
+
+        static constexpr size_t parallel_threshold = 1 << 20;
+        static constexpr size_t parallel_grain = 1 << 16;
+
+        void digest_append(const A &value);
+        void digest_prepend(const A &value);
+        void digest_pop_back(const A &value);
+        void digest_pop_front(const A &value);
+        void digest_invalidate();
+
+        void order_append(const A &value);
+        void order_prepend(const A &value);
+        void order_insert(typename linkedlist<A, Allocator>::node *before, const A &value);
+        void order_sorted();
+        void order_invalidate();
+        bool order_passed(A &current, const A &value) const;
+
+        singly_linked_list<A, Allocator, Inline> detach(size_t begin, size_t end);
+        size_t detach(size_t begin, size_t end, std::vector<A> &values);
+
+        typename linkedlist<A, Allocator>::node *pop_head();
+
+        typedef typename std::conditional<sizeof(A) == 1, unsigned char,
+                typename std::conditional<sizeof(A) == 2, unsigned short,
+                typename std::conditional<sizeof(A) == 4, unsigned int, unsigned long long>::type>::type>::type radix_type;
+
+        static radix_type radix_key(const A &value, std::true_type);
+        static radix_type radix_key(const A &value, std::false_type);
+
+        static typename linkedlist<A, Allocator>::node *adopt(singly_linked_list<A, Allocator, Inline> &to, singly_linked_list<A, Allocator, Inline> &from, typename linkedlist<A, Allocator>::node **link, const bool &relink);
+        static singly_linked_list<A, Allocator, Inline> combine(const singly_linked_list<A, Allocator, Inline> &left, const singly_linked_list<A, Allocator, Inline> &right, const bool &keep_left, const bool &keep_right, const bool &keep_equal);
+        static singly_linked_list<A, Allocator, Inline> combine(singly_linked_list<A, Allocator, Inline> &&left, singly_linked_list<A, Allocator, Inline> &&right, const bool &keep_left, const bool &keep_right, const bool &keep_equal);
+
+        template <typename Compare>
+        static typename linkedlist<A, Allocator>::node *mergesort(typename linkedlist<A, Allocator>::node *head, typename linkedlist<A, Allocator>::node **tail, Compare comp);
+        template <typename Compare>
+        static typename linkedlist<A, Allocator>::node *merge(typename linkedlist<A, Allocator>::node *left, typename linkedlist<A, Allocator>::node *right, Compare comp);
     public:
         singly_linked_list();
+        explicit singly_linked_list(const Allocator &alloc);
 
-        singly_linked_list(singly_linked_list<A> &&obj);
-        singly_linked_list(const singly_linked_list<A> &obj);
-        singly_linked_list(const std::initializer_list<A> &values);
+        singly_linked_list(singly_linked_list<A, Allocator, Inline> &&obj);
+        singly_linked_list(const singly_linked_list<A, Allocator, Inline> &obj);
+        singly_linked_list(const std::initializer_list<A> &values, const Allocator &alloc = Allocator());
         
         template <size_t N>
-        singly_linked_list(const A (&array)[N]);
-        singly_linked_list(const std::vector<A> &values);
-
-        // singly_linked_list(singly_linked_list<A> &&obj) noexcept = delete;
+        singly_linked_list(const A (&array)[N], const Allocator &alloc = Allocator());
+        singly_linked_list(const std::vector<A> &values, const Allocator &alloc = Allocator());
 
-        singly_linked_list<A> operator=(singly_linked_list<A> &&obj);
-        singly_linked_list<A> &operator=(const singly_linked_list<A> &obj);
-        singly_linked_list<A> &operator=(const std::initializer_list<A> &values);
+        singly_linked_list<A, Allocator, Inline> &operator=(singly_linked_list<A, Allocator, Inline> &&obj);
+        singly_linked_list<A, Allocator, Inline> &operator=(const singly_linked_list<A, Allocator, Inline> &obj);
+        singly_linked_list<A, Allocator, Inline> &operator=(const std::initializer_list<A> &values);
         
         template <size_t N>
-        singly_linked_list<A> &operator=(const A (&array)[N]);
-        singly_linked_list<A> &operator=(const std::vector<A> &values);
-
-        // singly_linked_list<A> &operator=(singly_linked_list<A> &&obj) noexcept = delete;
+        singly_linked_list<A, Allocator, Inline> &operator=(const A (&array)[N]);
+        singly_linked_list<A, Allocator, Inline> &operator=(const std::vector<A> &values);
 
         void prepend(const A &value) override;
         void append(const A &value) override;
         void insert(const int64_t &index, const A &value) override;
-        void insert(const int64_t &index, const linkedlist<A> &obj) override;
+        void insert(const int64_t &index, const linkedlist<A, Allocator> &obj) override;
         void insert(const int64_t &index, const std::initializer_list<A> &values) override;
         
         template <size_t N>
@@ -49,45 +149,103 @@ class singly_linked_list: public linkedlist<A>
         void insert(const int64_t &index, const std::vector<A> &values) override;
 
         void insert_in_order(const A &value) override;
-        void insert_in_order(const linkedlist<A> &obj) override;
+
+        template <typename Compare>
+        void insert_in_order(const A &value, Compare comp);
+        void insert_in_order(const linkedlist<A, Allocator> &obj) override;
         void insert_in_order(const std::initializer_list<A> &values) override;
         
         template <size_t N>
         void insert_in_order(const A (&array)[N]);
         void insert_in_order(const std::vector<A> &values) override;
 
-        void extend(const linkedlist<A> &obj) override;
+        void extend(const linkedlist<A, Allocator> &obj) override;
         void extend(const std::initializer_list<A> &values) override;
 
         template <size_t N>
         void extend(const A (&array)[N]);
         void extend(const std::vector<A> &values) override;
+        void extend_parallel(const std::vector<A> &values, const size_t &threads = 0);
 
         void remove(const A &value) override;
         A pop(const int64_t &index) override;
         A pop() override;
+        size_t remove_all(const A &value) override;
+        size_t erase(const int64_t &first, const int64_t &last) override;
 
-        constexpr size_t size() const override;
+        bool try_pop(const int64_t &index, A &value) override;
+        bool try_pop(A &value) override;
+        bool try_remove(const A &value) override;
+
+        typename linkedlist<A, Allocator>::iterator insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const A &value);
+        typename linkedlist<A, Allocator>::iterator insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const std::initializer_list<A> &values);
+
+        template <typename InputIt>
+        typename linkedlist<A, Allocator>::iterator insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, InputIt first, InputIt last);
+        typename linkedlist<A, Allocator>::iterator erase_after(const typename linkedlist<A, Allocator>::const_iterator &pos);
+        typename linkedlist<A, Allocator>::iterator erase_after(const typename linkedlist<A, Allocator>::const_iterator &first, const typename linkedlist<A, Allocator>::const_iterator &last);
+
+        template <typename Predicate>
+        size_t remove_if(Predicate pred);
+
+        singly_linked_list<A, Allocator, Inline> pop_front_n(const size_t &count);
+        size_t pop_front_n(const size_t &count, std::vector<A> &values);
+        singly_linked_list<A, Allocator, Inline> pop_back_n(const size_t &count);
+        size_t pop_back_n(const size_t &count, std::vector<A> &values);
+        singly_linked_list<A, Allocator, Inline> pop_range(const int64_t &index, const size_t &count);
+        size_t pop_range(const int64_t &index, const size_t &count, std::vector<A> &values);
+        singly_linked_list<A, Allocator, Inline> truncate(const size_t &new_size);
+        size_t truncate(const size_t &new_size, std::vector<A> &values);
 
         bool contains(const A &value) const override;
         int64_t index(const A &value) const override;
         size_t count(const A &value) const override;
+        bool try_index(const A &value, size_t &index) const override;
 
         void reverse() override;
         void sort() override;
 
-        singly_linked_list<A> copy() const;
+        template <typename Compare>
+        void sort(Compare comp);
+        template <typename KeyFn>
+        void sort_by_key(KeyFn key);
+        void radix_sort();
+        bool is_sorted() const;
+
+        size_t unique();
+
+        singly_linked_list<A, Allocator, Inline> set_union(const singly_linked_list<A, Allocator, Inline> &obj) const &;
+        singly_linked_list<A, Allocator, Inline> set_union(singly_linked_list<A, Allocator, Inline> &&obj) &&;
+        singly_linked_list<A, Allocator, Inline> set_intersection(const singly_linked_list<A, Allocator, Inline> &obj) const &;
+        singly_linked_list<A, Allocator, Inline> set_intersection(singly_linked_list<A, Allocator, Inline> &&obj) &&;
+        singly_linked_list<A, Allocator, Inline> set_difference(const singly_linked_list<A, Allocator, Inline> &obj) const &;
+        singly_linked_list<A, Allocator, Inline> set_difference(singly_linked_list<A, Allocator, Inline> &&obj) &&;
+        singly_linked_list<A, Allocator, Inline> set_symmetric_difference(const singly_linked_list<A, Allocator, Inline> &obj) const &;
+        singly_linked_list<A, Allocator, Inline> set_symmetric_difference(singly_linked_list<A, Allocator, Inline> &&obj) &&;
+
+        void compact();
+        double fragmentation() const;
+        void set_compaction_threshold(const double &threshold);
+
+        void set_hash_tracking(const bool &enabled);
+        void set_order_tracking(const bool &enabled);
+        size_t hash() const;
+
+        void set_trace(list_trace *trace);
+
+        singly_linked_list<A, Allocator, Inline> copy() const;
 
         A &operator[](const int64_t &index) override;
-        singly_linked_list<A> operator+(const linkedlist<A> &obj) const;
-        singly_linked_list<A> operator*(const size_t &times);
+        A *try_at(const int64_t &index) override;
+        singly_linked_list<A, Allocator, Inline> operator+(const linkedlist<A, Allocator> &obj) const;
+        singly_linked_list<A, Allocator, Inline> operator*(const size_t &times);
 
-        bool operator>(const linkedlist<A> &obj) const override;
-        bool operator<(const linkedlist<A> &obj) const override;
-        bool operator>=(const linkedlist<A> &obj) const override;
-        bool operator<=(const linkedlist<A> &obj) const override;
-        bool operator==(const linkedlist<A> &obj) const override;
-        bool operator!=(const linkedlist<A> &obj) const override;
+        bool operator>(const linkedlist<A, Allocator> &obj) const override;
+        bool operator<(const linkedlist<A, Allocator> &obj) const override;
+        bool operator>=(const linkedlist<A, Allocator> &obj) const override;
+        bool operator<=(const linkedlist<A, Allocator> &obj) const override;
+        bool operator==(const linkedlist<A, Allocator> &obj) const override;
+        bool operator!=(const linkedlist<A, Allocator> &obj) const override;
 
         template <size_t N>
         operator std::array<A, N>();
@@ -98,18 +256,42 @@ class singly_linked_list: public linkedlist<A>
         void show() override;
 
         void clear() override;
+
+        list_memory memory_usage() const override;
         
-        template <typename B>
-        friend std::ostream &operator<<(std::ostream &out, singly_linked_list<B> &obj);
+        template <typename B, typename C, size_t M>
+        friend std::ostream &operator<<(std::ostream &out, singly_linked_list<B, C, M> &obj);
 
         ~singly_linked_list();
 };
 
-template <typename A>
-singly_linked_list<A> operator*(const size_t &times, singly_linked_list<A> &obj);
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> operator*(const size_t &times, singly_linked_list<A, Allocator, Inline> &obj);
+
+template <typename A, typename Allocator, size_t Inline>
+std::ostream &operator<<(std::ostream &out, singly_linked_list<A, Allocator, Inline> &obj);
 
-template <typename A>
-std::ostream &operator<<(std::ostream &out, singly_linked_list<A> &obj);
+namespace std
+{
+    template <typename A, typename Allocator, size_t Inline>
+    struct hash<singly_linked_list<A, Allocator, Inline>>
+    {
+        size_t operator()(const singly_linked_list<A, Allocator, Inline> &obj) const
+        {
+            return obj.hash();
+        }
+    };
+}
+
+#if __cplusplus >= 201703L && defined(__has_include)
+    #if __has_include(<memory_resource>)
+        namespace pmr
+        {
+            template <typename A>
+            using singly_linked_list = ::singly_linked_list<A, std::pmr::polymorphic_allocator<A>>;
+        }
+    #endif
+#endif
 
 #include "./singly_linked_list.tpp"
 
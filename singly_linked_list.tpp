@@ -1,33 +1,133 @@
 #include "./singly_linked_list.hpp"
 
 
+#if __cplusplus < 201703L
+template <typename A, typename Allocator, size_t Inline>
+constexpr size_t singly_linked_list<A, Allocator, Inline>::parallel_threshold;
+
+template <typename A, typename Allocator, size_t Inline>
+constexpr size_t singly_linked_list<A, Allocator, Inline>::parallel_grain;
+#endif
+
 /**
- * @brief Default constructor for singly_linked_list.
+ * @brief Constructs the slots, all of them empty.
  */
-template <typename A>
-singly_linked_list<A>::singly_linked_list(): linkedlist<A>::linkedlist(),
-    length(new size_t(0)), ref_count(new size_t(1)) {}
+template <typename Node, size_t N>
+inline_nodes<Node, N>::inline_nodes():
+    occupied(0) {}
 
 /**
- * @brief Constructs a copy of a singly linked list.
+ * @brief Takes an empty slot.
  *
- * This constructor initializes a new `singly_linked_list` as a copy of the provided
- * `singly_linked_list` object. It copies the length and reference count from the 
- * original list and increments the reference count to manage shared ownership.
+ * @return The raw memory of the slot, nullptr if every slot holds a node.
+ */
+template <typename Node, size_t N>
+Node *inline_nodes<Node, N>::claim() const
+{
+    if (this->occupied == (N == 64 ? ~(uint64_t)0 : ((uint64_t)1 << N) - 1))
+        return nullptr;
+
+    size_t index = 0;
+    while (this->occupied & ((uint64_t)1 << index))
+        index++;
+
+    this->occupied |= (uint64_t)1 << index;
+    return reinterpret_cast<Node *>(this->slots) + index;
+}
+
+/**
+ * @brief Marks the slot of a destroyed node as empty.
  *
- * @param obj The `singly_linked_list` object to copy from.
+ * @param ptr The node, which must be in one of the slots.
  */
-template <typename A>
-singly_linked_list<A>::singly_linked_list(singly_linked_list<A> &&obj): linkedlist<A>::linkedlist()
+template <typename Node, size_t N>
+void inline_nodes<Node, N>::vacate(const Node *ptr) const
 {
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
-    while (ptr != nullptr)
-    {
-        this->append(ptr->value);
-        ptr = ptr->next;
-    }
+    this->occupied &= ~((uint64_t)1 << (ptr - reinterpret_cast<const Node *>(this->slots)));
+}
+
+/**
+ * @brief Checks whether a node is in one of the slots.
+ *
+ * @param ptr The node.
+ * @return true if the node is kept inline, otherwise false.
+ */
+template <typename Node, size_t N>
+bool inline_nodes<Node, N>::holds(const Node *ptr) const
+{
+    std::less<const Node *> before;
+    const Node *first = reinterpret_cast<const Node *>(this->slots);
+
+    return !before(ptr, first) && before(ptr, first + N);
+}
+
+/**
+ * @brief Returns the number of slots holding a node.
+ *
+ * @return The number of nodes kept inline.
+ */
+template <typename Node, size_t N>
+size_t inline_nodes<Node, N>::occupancy() const
+{
+    size_t count = 0;
+    for (uint64_t bits = this->occupied; bits != 0; bits &= bits - 1)
+        count++;
+
+    return count;
+}
+
+template <typename Node>
+Node *inline_nodes<Node, 0>::claim() const
+{
+    return nullptr;
+}
+
+template <typename Node>
+void inline_nodes<Node, 0>::vacate(const Node *) const {}
+
+template <typename Node>
+bool inline_nodes<Node, 0>::holds(const Node *) const
+{
+    return false;
+}
+
+template <typename Node>
+size_t inline_nodes<Node, 0>::occupancy() const
+{
+    return 0;
+}
+
+/**
+ * @brief Default constructor for singly_linked_list.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(): singly_linked_list<A, Allocator, Inline>(Allocator()) {}
+
+/**
+ * @brief Constructs an empty singly linked list using the given allocator.
+ *
+ * No memory is allocated until the first value is added.
+ *
+ * @param alloc The allocator to be used by the list.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(const Allocator &alloc): linkedlist<A, Allocator>::linkedlist(alloc) {}
 
-    *this->length = *obj.length;
+/**
+ * @brief Move constructor for singly_linked_list.
+ *
+ * Takes over the nodes and the allocator of `obj`, which is left as a valid
+ * empty list. Values `obj` keeps inline are moved into this list's own slots,
+ * which walks the list as far as the last of them.
+ *
+ * @param obj The singly_linked_list object to move from.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(singly_linked_list<A, Allocator, Inline> &&obj): linkedlist<A, Allocator>::linkedlist(obj.alloc)
+{
+    list_trace_scope emptied(obj.tracer(), trace_op::clear);
+    this->take(obj);
+    this->relocate(obj);
 }
 
 /**
@@ -36,27 +136,33 @@ singly_linked_list<A>::singly_linked_list(singly_linked_list<A> &&obj): linkedli
  * This constructor initializes a new `singly_linked_list` as a copy of the provided
  * `singly_linked_list` object. It copies the length and reference count from the 
  * original list and increments the reference count to manage shared ownership.
+ * The allocator is copied as well, since it has to free the shared nodes.
+ * Shared nodes cannot live inside either list object, so while `obj` keeps
+ * values inline they are copied into nodes of this list instead, leaving `obj`
+ * and any iterators into it untouched.
  *
  * @param obj The `singly_linked_list` object to copy from.
  */
-template <typename A>
-singly_linked_list<A>::singly_linked_list(const singly_linked_list<A> &obj): linkedlist<A>::linkedlist()
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(const singly_linked_list<A, Allocator, Inline> &obj): linkedlist<A, Allocator>::linkedlist(obj.alloc)
 {
-    this->head = obj.head;
-    this->tail = obj.tail;
-    this->length = obj.length;
-    this->ref_count = obj.ref_count;
+    if (obj.occupancy() > 0)
+    {
+        this->extend(obj);
+        return;
+    }
 
-    (*this->ref_count)++;
+    this->share(obj);
 }
 
 /**
  * @brief Constructor from an initializer list.
- * @param obj Initializer list of values to initialize the list with.
+ * @param values Initializer list of values to initialize the list with.
+ * @param alloc The allocator to be used by the list.
  */
-template <typename A>
-singly_linked_list<A>::singly_linked_list(const std::initializer_list<A> &values): linkedlist<A>::linkedlist(),
-    length(new size_t(0)), ref_count(new size_t(1))
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(const std::initializer_list<A> &values, const Allocator &alloc):
+    singly_linked_list<A, Allocator, Inline>(alloc)
 {
     this->extend(values);
 }
@@ -64,11 +170,12 @@ singly_linked_list<A>::singly_linked_list(const std::initializer_list<A> &values
 /**
  * @brief Constructor from an array.
  * @param array Array of values to initialize the list with.
+ * @param alloc The allocator to be used by the list.
  */
-template <typename A>
+template <typename A, typename Allocator, size_t Inline>
 template <size_t N>
-singly_linked_list<A>::singly_linked_list(const A (&array)[N]): linkedlist<A>::linkedlist(),
-    length(new size_t(0)), ref_count(new size_t(1))
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(const A (&array)[N], const Allocator &alloc):
+    singly_linked_list<A, Allocator, Inline>(alloc)
 {
     this->extend(array);
 }
@@ -76,65 +183,55 @@ singly_linked_list<A>::singly_linked_list(const A (&array)[N]): linkedlist<A>::l
 /**
  * @brief Constructor from a vector.
  * @param values Vector of values to initialize the list with.
+ * @param alloc The allocator to be used by the list.
  */
-template <typename A>
-singly_linked_list<A>::singly_linked_list(const std::vector<A> &values): linkedlist<A>::linkedlist(),
-    length(new size_t(0)), ref_count(new size_t(1))
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::singly_linked_list(const std::vector<A> &values, const Allocator &alloc):
+    singly_linked_list<A, Allocator, Inline>(alloc)
 {
     this->extend(values);
 }
 
-/**
- * @brief Move constructor for singly_linked_list.
- * @param obj The singly_linked_list object to move from.
- */
-// Causes RVO - Return Value Optimization causing - seg faults
-// template <typename A>
-// singly_linked_list<A>::singly_linked_list(singly_linked_list<A> &&obj) noexcept: linkedlist<A>::linkedlist()
-// {
-//     this->head = linkedlist<A>::gethead(obj);
-//     this->tail = linkedlist<A>::gettail(obj);
-//     this->length = obj.length;
-//     this->ref_count = obj.ref_count;
-
-//   *  obj.head = nullptr;
-//   *  obj.tail = nullptr;
-//     obj.length = new size_t(0);
-//     obj.ref_count = new size_t(1);
-// }
-
 /**
  * @brief Assigns the contents of another singly linked list to this list.
  *
- * This assignment operator first checks for self-assignment, then copies the 
- * elements and metadata (length and reference count) from the provided 
+ * This assignment operator first checks for self-assignment, then shares the 
+ * elements and metadata (length and reference count) of the provided 
  * `singly_linked_list` object. It increments the reference count for shared 
  * ownership management.
  *
+ * The allocator of `obj` is adopted when it propagates on copy assignment. Nodes
+ * cannot be shared between unequal allocators that do not propagate, nor while
+ * `obj` keeps values inline, so in those cases the values are copied into this
+ * list's own nodes instead and `obj` is left untouched.
+ *
  * @param obj The `singly_linked_list` object to assign from.
  * @return A reference to this `singly_linked_list`.
  */
-template <typename A>
-singly_linked_list<A> &singly_linked_list<A>::operator=(const singly_linked_list<A> &obj)
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> &singly_linked_list<A, Allocator, Inline>::operator=(const singly_linked_list<A, Allocator, Inline> &obj)
 {
-    if (this == &obj)
+    typedef typename std::allocator_traits<Allocator>::propagate_on_container_copy_assignment propagate;
+
+    if (this == &obj || this->state == obj.state)
         return *this;
 
-    (*this->ref_count)--;
-    if (*this->ref_count == 0)
+    LINKEDLIST_TRACE_RESULT();
+    this->release();
+
+    if ((!propagate::value && this->alloc != obj.alloc) || obj.occupancy() > 0)
     {
-        this->clear();
+        this->reset();
+        this->extend(obj);
 
-        delete this->length;
-        delete this->ref_count;
+        return *this;
     }
 
-    this->head = obj.head;
-    this->tail = obj.tail;
-    this->length = obj.length;
-    this->ref_count = obj.ref_count;
+    if (propagate::value)
+        this->propagate_options(obj.alloc);
+    linkedlist<A, Allocator>::propagate_copy(this->alloc, obj.alloc, propagate());
+    this->share(obj);
 
-    (*this->ref_count)++;
     return *this;
 }
 
@@ -143,20 +240,12 @@ singly_linked_list<A> &singly_linked_list<A>::operator=(const singly_linked_list
  * @param values The initializer list containing the values to assign.
  * @return A reference to this singly_linked_list.
  */
-template <typename A>
-singly_linked_list<A>& singly_linked_list<A>::operator=(const std::initializer_list<A> &values) 
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>& singly_linked_list<A, Allocator, Inline>::operator=(const std::initializer_list<A> &values) 
 {
-    (*this->ref_count)--;
-    if (*this->ref_count == 0)
-    {
-        this->clear();
-
-        delete this->length;
-        delete this->ref_count;
-    }
-
-    this->length = new size_t(0);
-    this->ref_count = new size_t(1);
+    LINKEDLIST_TRACE_RESULT();
+    this->release();
+    this->reset();
 
     this->extend(values);
     return *this;
@@ -168,22 +257,13 @@ singly_linked_list<A>& singly_linked_list<A>::operator=(const std::initializer_l
  * @param array The static array containing the values to assign.
  * @return A reference to this singly_linked_list.
  */
-template <typename A>
+template <typename A, typename Allocator, size_t Inline>
 template <size_t N>
-singly_linked_list<A>& singly_linked_list<A>::operator=(const A (&array)[N]) 
+singly_linked_list<A, Allocator, Inline>& singly_linked_list<A, Allocator, Inline>::operator=(const A (&array)[N]) 
 {
-    (*this->ref_count)--;
-    if (*this->ref_count == 0)
-    {
-        this->clear();
-
-        delete this->length;
-        delete this->ref_count;
-    }
-
-    *this->head = *this->tail = nullptr;
-    this->length = new size_t(0);
-    this->ref_count = new size_t(1);
+    LINKEDLIST_TRACE_RESULT();
+    this->release();
+    this->reset();
 
     this->extend(array);
     return *this;
@@ -194,139 +274,110 @@ singly_linked_list<A>& singly_linked_list<A>::operator=(const A (&array)[N])
  * @param values The vector containing the values to assign.
  * @return A reference to this singly_linked_list.
  */
-template <typename A>
-singly_linked_list<A>& singly_linked_list<A>::operator=(const std::vector<A> &values) 
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>& singly_linked_list<A, Allocator, Inline>::operator=(const std::vector<A> &values) 
 {
-    (*this->ref_count)--;
-    if (*this->ref_count == 0)
-    {
-        this->clear();
-
-        delete this->length;
-        delete this->ref_count;
-    }
-
-    *this->head = *this->tail = nullptr;
-    this->length = new size_t(0);
-    this->ref_count = new size_t(1);
+    LINKEDLIST_TRACE_RESULT();
+    this->release();
+    this->reset();
 
     this->extend(values);
     return *this;
 }
 
 /**
- * @brief Assigns the contents of another singly linked list to this list.
+ * @brief Move assignment operator for transferring from another singly_linked_list.
  *
- * This assignment operator first checks for self-assignment, then copies the 
- * elements and metadata (length and reference count) from the provided 
- * `singly_linked_list` object. It increments the reference count for shared 
- * ownership management.
+ * Releases the current contents and takes over the nodes of `obj`, which is left
+ * empty, together with its allocator when it propagates on move assignment.
+ * Unequal allocators that do not propagate cannot take over each other's nodes,
+ * so the values of `obj` are copied instead.
  *
- * @param obj The `singly_linked_list` object to assign from.
- * @return A reference to this `singly_linked_list`.
+ * @param obj The singly_linked_list object to move from.
+ * @return A reference to this singly_linked_list.
  */
-template <typename A>
-singly_linked_list<A> singly_linked_list<A>::operator=(singly_linked_list<A> &&obj)
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> &singly_linked_list<A, Allocator, Inline>::operator=(singly_linked_list<A, Allocator, Inline> &&obj)
 {
-    (*this->ref_count)--;
-    if (*this->ref_count == 0)
-    {
-        this->clear();
+    typedef typename std::allocator_traits<Allocator>::propagate_on_container_move_assignment propagate;
 
-        delete this->ref_count;
-        delete this->length;
-    }
+    if (this == &obj)
+        return *this;
 
-    *this->head = *this->tail = nullptr;
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
-    while (ptr != nullptr)
+    LINKEDLIST_TRACE_RESULT();
+    this->release();
+
+    if (!propagate::value && this->alloc != obj.alloc)
     {
-        this->append(ptr->value);
-        ptr = ptr->next;
+        this->reset();
+        this->extend(obj);
+
+        return *this;
     }
-    
-    this->length = new size_t(*obj.length);
-    this->ref_count = new size_t(1);
+
+    if (propagate::value)
+        this->propagate_options(obj.alloc);
+    linkedlist<A, Allocator>::propagate_move(this->alloc, obj.alloc, propagate());
+    list_trace_scope emptied(obj.tracer(), trace_op::clear);
+    this->take(obj);
+    this->relocate(obj);
 
     return *this;
 }
 
-/**
- * @brief Move assignment operator for transferring from another singly_linked_list.
- * @param obj The singly_linked_list object to move from.
- * @return A reference to this singly_linked_list.
- */
-// Causes RVO problems
-// template <typename A>
-// singly_linked_list<A> &singly_linked_list<A>::operator=(singly_linked_list<A> &&obj) noexcept
-// {
-//     (*this->ref_count)--;
-//     if (*this->ref_count == 0)
-//     {
-//         this->clear();
-
-//         delete this->length;
-//         delete this->ref_count;
-//     }
-
-//     this->head = linkedlist<A>::gethead(obj);
-//     this->tail = linkedlist<A>::gettail(obj);
-//     this->length = obj.length;
-//     this->ref_count = obj.ref_count;
-
-//     obj.head = nullptr;
-//     obj.tail = nullptr;
-//     obj.length = nullptr;
-//     obj.ref_count = nullptr;
-
-//     return *this;
-// }
-
 /**
  * @brief Prepend a value to the list.
  * @param value The value to prepend.
  */
-template <typename A>
-void singly_linked_list<A>::prepend(const A &value)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::prepend(const A &value)
 {
-    typename linkedlist<A>::node *new_node = new typename linkedlist<A>::node;
+    LINKEDLIST_TRACE(trace_op::prepend, value);
+
+    typename linkedlist<A, Allocator>::node *new_node = this->alloc_node();
+    LINKEDLIST_STAT_ALLOC();
     new_node->value = value;
-    new_node->next = *this->head;
+    new_node->next = this->state->head;
+    this->order_prepend(value);
 
     if (this->isempty())
-    {
-        (*this->ref_count)++;
-        *this->tail = new_node;
-    }
+        this->state->tail = new_node;
 
-    *this->head = new_node;
+    this->state->head = new_node;
     
-    (*this->length)++;
+    (this->state->length)++;
+    this->digest_prepend(value);
 }
 
 /**
  * @brief Append a value to the list.
  * @param value The value to append.
  */
-template <typename A>
-void singly_linked_list<A>::append(const A &value)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::append(const A &value)
 {
-    typename linkedlist<A>::node *new_node = new typename linkedlist<A>::node;
+    LINKEDLIST_TRACE(trace_op::append, value);
+
+    typename linkedlist<A, Allocator>::node *new_node = this->alloc_node();
+    LINKEDLIST_STAT_ALLOC();
     new_node->value = value;
     new_node->next = nullptr;
+    this->order_append(value);
 
     if (this->isempty())
     {
-        *this->head = new_node;
-        *this->tail = new_node;
-        (*this->length)++;
+        this->state->head = new_node;
+        this->state->tail = new_node;
+        (this->state->length)++;
+        this->digest_append(value);
         return;
     }
 
-    (*this->tail)->next = new_node;
-    *this->tail = new_node;
+    (this->state->tail)->next = new_node;
+    this->state->tail = new_node;
     
-    (*this->length)++;
+    (this->state->length)++;
+    this->digest_append(value);
 }
 
 /**
@@ -334,9 +385,12 @@ void singly_linked_list<A>::append(const A &value)
  * @param index The position at which to insert the value.
  * @param value The value to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert(const int64_t &index, const A &value)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert(const int64_t &index, const A &value)
 {
+    LINKEDLIST_TRACE(trace_op::insert, index, value);
+    LINKEDLIST_STAT_SCOPE(list_op::insert);
+
     if (this->isempty() || index == 0L || index <= -(int64_t)(this->size()))
     {
         this->prepend(value);
@@ -353,18 +407,22 @@ void singly_linked_list<A>::insert(const int64_t &index, const A &value)
     if (index < 0L)
         curr_index = -(int64_t)(this->size());
 
-    typename linkedlist<A>::node *new_node = new typename linkedlist<A>::node, *ptr = *this->head;
+    typename linkedlist<A, Allocator>::node *new_node = this->alloc_node(), *ptr = this->state->head;
+    LINKEDLIST_STAT_ALLOC();
     new_node->value = value;
     while (curr_index != index - 1L)
     {
         ptr = ptr->next;
         curr_index++;
+        LINKEDLIST_STAT_HOP();
     }
 
+    this->order_insert(ptr, value);
     new_node->next = ptr->next;
     ptr->next = new_node;
     
-    (*this->length)++;
+    (this->state->length)++;
+    this->digest_invalidate();
 }
 
 /**
@@ -372,11 +430,11 @@ void singly_linked_list<A>::insert(const int64_t &index, const A &value)
  * @param index The position at which to insert the linked list.
  * @param obj The linked list to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert(const int64_t &index, const linkedlist<A> &obj)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert(const int64_t &index, const linkedlist<A, Allocator> &obj)
 {
     int64_t curr_index = index;
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr != nullptr)
     {
         this->insert(curr_index++, ptr->value);
@@ -389,8 +447,8 @@ void singly_linked_list<A>::insert(const int64_t &index, const linkedlist<A> &ob
  * @param index The position at which to insert the values.
  * @param values The initializer list of values to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert(const int64_t &index, const std::initializer_list<A> &values)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert(const int64_t &index, const std::initializer_list<A> &values)
 {
     int64_t curr_index = index;
     for (const A &value: values)
@@ -403,9 +461,9 @@ void singly_linked_list<A>::insert(const int64_t &index, const std::initializer_
  * @param index The position at which to insert the array.
  * @param array The array of values to insert.
  */
-template <typename A>
+template <typename A, typename Allocator, size_t Inline>
 template <size_t N>
-void singly_linked_list<A>::insert(const int64_t &index, const A (&array)[N])
+void singly_linked_list<A, Allocator, Inline>::insert(const int64_t &index, const A (&array)[N])
 {
     for (const A &value: array)
         this->insert(index, value);
@@ -416,8 +474,8 @@ void singly_linked_list<A>::insert(const int64_t &index, const A (&array)[N])
  * @param index The position at which to insert the vector.
  * @param values The vector of values to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert(const int64_t &index, const std::vector<A> &values)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert(const int64_t &index, const std::vector<A> &values)
 {
     int64_t curr_index = index;
     for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
@@ -428,36 +486,100 @@ void singly_linked_list<A>::insert(const int64_t &index, const std::vector<A> &v
  * @brief Insert a value into the list in sorted index.
  * @param value The value to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert_in_order(const A &value)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert_in_order(const A &value)
 {
-    if (this->isempty() || (*this->head)->value >= value)
+    LINKEDLIST_TRACE(trace_op::insert_in_order, value);
+    LINKEDLIST_STAT_SCOPE(list_op::insert_in_order);
+
+    if (this->isempty() || (LINKEDLIST_STAT_COMPARE(), (this->state->head)->value >= value))
     {
         this->prepend(value);
         return;
     }
 
-    if ((*this->tail)->value <= value)
+    LINKEDLIST_STAT_COMPARE();
+    if ((this->state->tail)->value <= value)
     {
         this->append(value);
         return;
     }
 
-    typename linkedlist<A>::node *new_node = new typename linkedlist<A>::node, *ptr = *this->head;
+    typename linkedlist<A, Allocator>::node *new_node = this->alloc_node(), *ptr = this->state->head;
+    LINKEDLIST_STAT_ALLOC();
     new_node->value = value;
     while (ptr->next != nullptr)
     {
+        LINKEDLIST_STAT_COMPARE();
         if (ptr->next->value >= value)
             break;
         ptr = ptr->next;
+        LINKEDLIST_STAT_HOP();
     }
 
     if (ptr->next == nullptr)
-        *this->tail = new_node;
+    {
+        this->order_append(value);
+        this->state->tail = new_node;
+    }
+    else
+        this->order_insert(ptr, value);
     new_node->next = ptr->next;
     ptr->next = new_node;
     
-    (*this->length)++;
+    (this->state->length)++;
+    this->digest_invalidate();
+}
+
+/**
+ * @brief Insert a value into a list sorted by a comparator.
+ *
+ * The value goes before the first element that does not compare less than
+ * it, as with `insert_in_order(value)` and `<`. A trace records the call as the
+ * `prepend`, `append` or `insert_after` it amounts to.
+ *
+ * @param value The value to insert.
+ * @param comp A strict weak ordering; `comp(a, b)` is true if `a` goes before `b`.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename Compare>
+void singly_linked_list<A, Allocator, Inline>::insert_in_order(const A &value, Compare comp)
+{
+    LINKEDLIST_STAT_SCOPE(list_op::insert_in_order);
+
+    if (this->isempty() || (LINKEDLIST_STAT_COMPARE(), !comp(this->state->head->value, value)))
+    {
+        this->prepend(value);
+        return;
+    }
+
+    LINKEDLIST_STAT_COMPARE();
+    if (!comp(value, this->state->tail->value))
+    {
+        this->append(value);
+        return;
+    }
+
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    int64_t position = 1;
+    while (ptr->next != nullptr && (LINKEDLIST_STAT_COMPARE(), comp(ptr->next->value, value)))
+    {
+        ptr = ptr->next;
+        position++;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    LINKEDLIST_TRACE(trace_op::insert_after, position, value);
+    typename linkedlist<A, Allocator>::node *new_node = this->alloc_node();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+
+    this->order_insert(ptr, value);
+    new_node->next = ptr->next;
+    ptr->next = new_node;
+
+    (this->state->length)++;
+    this->digest_invalidate();
 }
 
 /**
@@ -465,10 +587,10 @@ void singly_linked_list<A>::insert_in_order(const A &value)
  * @param index The position at which to insert the linked list.
  * @param obj The linked list to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert_in_order(const linkedlist<A> &obj)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert_in_order(const linkedlist<A, Allocator> &obj)
 {
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr != nullptr)
     {
         this->insert_in_order(ptr->value);
@@ -481,8 +603,8 @@ void singly_linked_list<A>::insert_in_order(const linkedlist<A> &obj)
  * @param index The position at which to insert the values.
  * @param values The initializer list of values to insert.
  */
-template <typename A>
-void singly_linked_list<A>::insert_in_order(const std::initializer_list<A> &values)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert_in_order(const std::initializer_list<A> &values)
 {
     for (const A &value: values)
         this->insert_in_order(value);
@@ -494,9 +616,9 @@ void singly_linked_list<A>::insert_in_order(const std::initializer_list<A> &valu
  * @param index The position at which to insert the array.
  * @param array The array of values to insert.
  */
-template <typename A>
+template <typename A, typename Allocator, size_t Inline>
 template <size_t N>
-void singly_linked_list<A>::insert_in_order(const A (&array)[N])
+void singly_linked_list<A, Allocator, Inline>::insert_in_order(const A (&array)[N])
 {
     for (const A &value: array)
         this->insert_in_order(value);
@@ -510,8 +632,8 @@ void singly_linked_list<A>::insert_in_order(const A (&array)[N])
  * @param index The index at which to start inserting the values.
  * @param values A vector containing the values to be inserted.
  */
-template <typename A>
-void singly_linked_list<A>::insert_in_order(const std::vector<A> &values)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::insert_in_order(const std::vector<A> &values)
 {
     for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
         this->insert_in_order(*it);
@@ -525,13 +647,15 @@ void singly_linked_list<A>::insert_in_order(const std::vector<A> &values)
  * @param obj The linked list to be extended.
  */
 // To extend by reference not by copy - ref_count & scope destructor problems
-template <typename A>
-void singly_linked_list<A>::extend(const linkedlist<A> &obj)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::extend(const linkedlist<A, Allocator> &obj)
 {
+    LINKEDLIST_TRACE(trace_op::extend, make_trace_range(obj.cbegin(), obj.cend(), obj.size()));
+
     if (obj.isempty())
         return;
     
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr != nullptr)
     {
         this->append(ptr->value);
@@ -540,341 +664,2442 @@ void singly_linked_list<A>::extend(const linkedlist<A> &obj)
 }
 
 /**
- * @brief Extends the singly linked list with the contents of an initializer list.
- *
- * This method appends the values from the provided initializer list to the current list.
- *
- * @param values An initializer list containing the values to be appended.
+ * @brief Extends the singly linked list with the contents of an initializer list.
+ *
+ * This method appends the values from the provided initializer list to the current list.
+ *
+ * @param values An initializer list containing the values to be appended.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::extend(const std::initializer_list<A> &values)
+{
+    LINKEDLIST_TRACE(trace_op::extend, make_trace_range(values.begin(), values.end(), values.size()));
+
+    for (const A &value: values)
+        this->append(value);
+}
+
+/**
+ * @brief Extends the singly linked list with the contents of an array.
+ *
+ * This method appends the values from the provided array to the current list.
+ *
+ * @tparam N The size of the array.
+ * @param array An array containing the values to be appended.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <size_t N>
+void singly_linked_list<A, Allocator, Inline>::extend(const A (&array)[N])
+{
+    LINKEDLIST_TRACE(trace_op::extend, make_trace_range(array, array + N, N));
+
+    if (std::is_trivially_copyable<A>::value && N >= singly_linked_list<A, Allocator, Inline>::parallel_threshold)
+    {
+        this->append_parallel(array, N, 0);
+        return;
+    }
+
+    for (const A &value: array)
+        this->append(value);
+}
+
+/**
+ * @brief Extends the singly linked list with the contents of a vector.
+ *
+ * This method appends the values from the provided vector to the current list.
+ * Vectors of at least 2^20 trivially copyable values are built in parallel, as
+ * by extend_parallel().
+ *
+ * @param values A vector containing the values to be appended.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::extend(const std::vector<A> &values)
+{
+    LINKEDLIST_TRACE(trace_op::extend, make_trace_range(values.begin(), values.end(), values.size()));
+
+    if (std::is_trivially_copyable<A>::value && values.size() >= singly_linked_list<A, Allocator, Inline>::parallel_threshold)
+    {
+        this->append_parallel(values.data(), values.size(), 0);
+        return;
+    }
+
+    for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
+        this->append(*it);
+}
+
+/**
+ * @brief Extends the singly linked list with a vector, building the nodes on several threads.
+ *
+ * The input is split into one contiguous slice per thread. Each slice gets one
+ * slab of nodes, allocated up front on the calling thread; the workers then
+ * copy and link their slice, and the sub-chains are stitched onto the list in
+ * order. The slabs are managed as by compact(), so the new nodes are also laid
+ * out in list order. Inputs too small to give every thread 2^16 values use
+ * fewer threads, and below two threads this is the same as extend().
+ *
+ * Copying values concurrently must be safe for `A`; it is for any type whose
+ * copy constructor only reads its source.
+ *
+ * @param values A vector containing the values to be appended.
+ * @param threads The number of threads to use, or 0 for `std::thread::hardware_concurrency()`.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::extend_parallel(const std::vector<A> &values, const size_t &threads)
+{
+    LINKEDLIST_TRACE(trace_op::extend, make_trace_range(values.begin(), values.end(), values.size()));
+
+    this->append_parallel(values.data(), values.size(), threads);
+}
+
+/**
+ * @brief Removes the first occurrence of a specific value from the singly linked list.
+ *
+ * This method removes the first node containing the specified value. If the value is not found, an exception is thrown.
+ *
+ * @param value The value to be removed.
+ * @throws VALUE_ERROR If the list is empty or the value is not found.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::remove(const A &value)
+{
+    LINKEDLIST_TRACE(trace_op::remove, value);
+
+    if (this->try_remove(value))
+        return;
+
+    throw VALUE_ERROR(this->isempty() ? "Removing from Empty List" : "Removing `x`, non-element in the List");
+}
+
+/**
+ * @brief Removes the first occurrence of a specific value, without throwing.
+ *
+ * @param value The value to be removed.
+ * @return true if a value was removed, false if the value is not in the list.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::try_remove(const A &value)
+{
+    LINKEDLIST_TRACE(trace_op::try_remove, value);
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    typename linkedlist<A, Allocator>::node **link = &this->state->head, *prev = nullptr;
+    while (*link != nullptr && !((*link)->value == value))
+    {
+        prev = *link;
+        link = &prev->next;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    typename linkedlist<A, Allocator>::node *ptr = *link;
+    if (ptr == nullptr)
+        return false;
+
+    if (prev == nullptr)
+        this->digest_pop_front(ptr->value);
+    else if (ptr->next == nullptr)
+        this->digest_pop_back(ptr->value);
+    else
+        this->digest_invalidate();
+
+    *link = ptr->next;
+    if (ptr == this->state->tail)
+        this->state->tail = prev;
+
+    this->free_node(ptr);
+    LINKEDLIST_STAT_FREE();
+
+    (this->state->length)--;
+    return true;
+}
+
+/**
+ * @brief Pops and returns the value at a specific index from the singly linked list.
+ *
+ * This method removes and returns the node at the specified index. Negative indices count from the end.
+ *
+ * @param index The index of the node to be popped.
+ * @return The value of the node at the specified index.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, typename Allocator, size_t Inline>
+A singly_linked_list<A, Allocator, Inline>::pop(const int64_t &index)
+{
+    LINKEDLIST_TRACE(trace_op::pop, index);
+
+    A value;
+    if (this->try_pop(index, value))
+        return value;
+
+    throw INDEX_ERROR(this->isempty() ? "Pop from Empty List" : "Pop index out of range");
+}
+
+/**
+ * @brief Pops and returns the last value from the singly linked list.
+ *
+ * This method removes and returns the last node from the list.
+ *
+ * @return The value of the last node.
+ */
+template <typename A, typename Allocator, size_t Inline>
+A singly_linked_list<A, Allocator, Inline>::pop()
+{
+    LINKEDLIST_TRACE(trace_op::pop_back);
+
+    return this->pop(-1L);
+}
+
+/**
+ * @brief Pops the value at a specific index, without throwing.
+ *
+ * Negative indices count from the end. On a miss `value` is left untouched.
+ *
+ * @param index The index of the node to be popped.
+ * @param value Receives the popped value.
+ * @return true if a value was popped, false if the index is out of range.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::try_pop(const int64_t &index, A &value)
+{
+    LINKEDLIST_TRACE(trace_op::try_pop, index);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    const int64_t length = (int64_t)this->state->length;
+    if (index < -length || index >= length)
+        return false;
+
+    const size_t position = (size_t)(index < 0L ? index + length : index);
+    typename linkedlist<A, Allocator>::node **link = &this->state->head, *prev = nullptr;
+    for (size_t i = 0; i < position; i++)
+    {
+        prev = *link;
+        link = &prev->next;
+    }
+    LINKEDLIST_STAT_HOPS(position);
+
+    typename linkedlist<A, Allocator>::node *ptr = *link;
+    value = std::move(ptr->value);
+
+    *link = ptr->next;
+    if (ptr == this->state->tail)
+        this->state->tail = prev;
+
+    this->free_node(ptr);
+    LINKEDLIST_STAT_FREE();
+    (this->state->length)--;
+
+    if (position == 0)
+        this->digest_pop_front(value);
+    else if (*link == nullptr)
+        this->digest_pop_back(value);
+    else
+        this->digest_invalidate();
+
+    return true;
+}
+
+/**
+ * @brief Pops the last value, without throwing.
+ *
+ * @param value Receives the popped value.
+ * @return true if a value was popped, false if the list is empty.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::try_pop(A &value)
+{
+    LINKEDLIST_TRACE(trace_op::try_pop_back);
+
+    return this->try_pop(-1L, value);
+}
+
+/**
+ * @brief Removes every occurrence of a value in a single pass.
+ *
+ * Unlike remove(), this does not throw when the value is absent.
+ *
+ * @param value The value to be removed.
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::remove_all(const A &value)
+{
+    LINKEDLIST_TRACE(trace_op::remove_all, value);
+
+    return this->remove_if([&value](A &element) { return element == value; });
+}
+
+/**
+ * @brief Removes every value that satisfies a predicate in a single pass.
+ *
+ * If `pred` throws, the values removed so far stay removed and the list is
+ * left valid. A trace records the values that are left.
+ *
+ * @tparam Predicate A callable taking a value reference and returning bool.
+ * @param pred The predicate selecting the values to be removed.
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename Predicate>
+size_t singly_linked_list<A, Allocator, Inline>::remove_if(Predicate pred)
+{
+    LINKEDLIST_TRACE_RESULT();
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    this->digest_invalidate();
+    size_t removed = 0;
+    typename linkedlist<A, Allocator>::node **link = &this->state->head, *kept = nullptr;
+    while (*link != nullptr)
+    {
+        typename linkedlist<A, Allocator>::node *ptr = *link;
+        if (!pred(ptr->value))
+        {
+            kept = ptr;
+            link = &ptr->next;
+            LINKEDLIST_STAT_HOP();
+            continue;
+        }
+
+        *link = ptr->next;
+        if (ptr->next == nullptr)
+            this->state->tail = kept;
+
+        this->free_node(ptr);
+        LINKEDLIST_STAT_FREE();
+
+        (this->state->length)--;
+        removed++;
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Removes the values at positions `first` up to, not including, `last`.
+ *
+ * Bounds follow Python slicing: negative bounds count from the end and bounds
+ * past either end are clamped, so an empty range removes nothing.
+ *
+ * @param first The position of the first value to be removed.
+ * @param last The position after the last value to be removed.
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::erase(const int64_t &first, const int64_t &last)
+{
+    LINKEDLIST_TRACE(trace_op::erase, first, last);
+    LINKEDLIST_STAT_SCOPE(list_op::remove);
+
+    size_t begin = linkedlist<A, Allocator>::bound(first, this->state->length);
+    size_t end = linkedlist<A, Allocator>::bound(last, this->state->length);
+    if (begin >= end)
+        return 0;
+
+    this->digest_invalidate();
+    typename linkedlist<A, Allocator>::node **link = &this->state->head, *kept = nullptr;
+    for (size_t i = 0; i < begin; i++)
+    {
+        kept = *link;
+        link = &kept->next;
+    }
+    LINKEDLIST_STAT_HOPS(begin);
+
+    for (size_t i = begin; i < end; i++)
+    {
+        typename linkedlist<A, Allocator>::node *ptr = *link;
+        *link = ptr->next;
+        this->free_node(ptr);
+        LINKEDLIST_STAT_FREE();
+    }
+
+    if (*link == nullptr)
+        this->state->tail = kept;
+
+    this->state->length -= end - begin;
+    return end - begin;
+}
+
+/**
+ * @brief Inserts a value after the position of an iterator in O(1).
+ *
+ * Use before_begin() to insert at the front. Iterators stay valid.
+ *
+ * @param pos The iterator after which the value is inserted.
+ * @param value The value to insert.
+ * @return An iterator to the inserted value.
+ * @throws INDEX_ERROR If `pos` is end().
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::iterator singly_linked_list<A, Allocator, Inline>::insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const A &value)
+{
+    LINKEDLIST_TRACE(trace_op::insert_after, this->trace_position(pos), value);
+    typename linkedlist<A, Allocator>::node **link = linkedlist<A, Allocator>::getlink(pos);
+    if (link == nullptr)
+        throw INDEX_ERROR("Inserting after the end of the List");
+
+    typename linkedlist<A, Allocator>::node *new_node = this->alloc_node();
+    LINKEDLIST_STAT_ALLOC();
+    new_node->value = value;
+    if (*link == nullptr)
+        this->order_append(value);
+    else if (link == &this->state->head)
+        this->order_prepend(value);
+    else
+        this->order_insert(linkedlist<A, Allocator>::unwrap(pos), value);
+
+    new_node->next = *link;
+    *link = new_node;
+
+    if (new_node->next == nullptr)
+    {
+        this->state->tail = new_node;
+        this->digest_append(value);
+    }
+    else if (link == &this->state->head)
+        this->digest_prepend(value);
+    else
+        this->digest_invalidate();
+
+    (this->state->length)++;
+    return linkedlist<A, Allocator>::wrap(new_node);
+}
+
+/**
+ * @brief Inserts the values of an initializer list after the position of an iterator.
+ *
+ * @param pos The iterator after which the values are inserted.
+ * @param values The values to insert, in order.
+ * @return An iterator to the last inserted value, or `pos` if `values` is empty.
+ * @throws INDEX_ERROR If `pos` is end().
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::iterator singly_linked_list<A, Allocator, Inline>::insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, const std::initializer_list<A> &values)
+{
+    return this->insert_after(pos, values.begin(), values.end());
+}
+
+/**
+ * @brief Inserts a range of values after the position of an iterator.
+ *
+ * Each value costs O(1), whatever the position.
+ *
+ * @tparam InputIt An input iterator over values convertible to A.
+ * @param pos The iterator after which the values are inserted.
+ * @param first The beginning of the range.
+ * @param last The end of the range.
+ * @return An iterator to the last inserted value, or `pos` if the range is empty.
+ * @throws INDEX_ERROR If `pos` is end().
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename InputIt>
+typename linkedlist<A, Allocator>::iterator singly_linked_list<A, Allocator, Inline>::insert_after(const typename linkedlist<A, Allocator>::const_iterator &pos, InputIt first, InputIt last)
+{
+    if (linkedlist<A, Allocator>::getlink(pos) == nullptr)
+        throw INDEX_ERROR("Inserting after the end of the List");
+
+    typename linkedlist<A, Allocator>::iterator it = linkedlist<A, Allocator>::wrap(pos);
+    for (; first != last; ++first)
+        it = this->insert_after(it, *first);
+
+    return it;
+}
+
+/**
+ * @brief Removes the value after the position of an iterator in O(1).
+ *
+ * Use before_begin() to remove the first value. Only iterators to the removed
+ * value are invalidated.
+ *
+ * @param pos The iterator before the value to be removed.
+ * @return An iterator to the value that followed the removed one.
+ * @throws INDEX_ERROR If there is no value after `pos`.
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::iterator singly_linked_list<A, Allocator, Inline>::erase_after(const typename linkedlist<A, Allocator>::const_iterator &pos)
+{
+    const int64_t position = this->trace_position(pos);
+    LINKEDLIST_TRACE(trace_op::erase_after, position, position + 1);
+    typename linkedlist<A, Allocator>::node **link = linkedlist<A, Allocator>::getlink(pos);
+    if (link == nullptr || *link == nullptr)
+        throw INDEX_ERROR("Erasing after the last element of the List");
+
+    typename linkedlist<A, Allocator>::node *ptr = *link;
+    *link = ptr->next;
+
+    if (ptr->next == nullptr)
+    {
+        this->state->tail = linkedlist<A, Allocator>::unwrap(pos);
+        this->digest_pop_back(ptr->value);
+    }
+    else if (link == &this->state->head)
+        this->digest_pop_front(ptr->value);
+    else
+        this->digest_invalidate();
+
+    this->free_node(ptr);
+    LINKEDLIST_STAT_FREE();
+
+    (this->state->length)--;
+    return linkedlist<A, Allocator>::wrap(*link);
+}
+
+/**
+ * @brief Removes the values strictly between two iterators.
+ *
+ * Each removed value costs O(1); `first` itself and `last` are kept.
+ *
+ * @param first The iterator before the first value to be removed.
+ * @param last The iterator after the last value to be removed, which must be reachable from `first`.
+ * @return `last`.
+ * @throws INDEX_ERROR If `first` is end().
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::iterator singly_linked_list<A, Allocator, Inline>::erase_after(const typename linkedlist<A, Allocator>::const_iterator &first, const typename linkedlist<A, Allocator>::const_iterator &last)
+{
+    LINKEDLIST_TRACE(trace_op::erase_after, this->trace_position(first), this->trace_position(last) - 1);
+    typename linkedlist<A, Allocator>::node **link = linkedlist<A, Allocator>::getlink(first);
+    if (link == nullptr)
+        throw INDEX_ERROR("Erasing after the end of the List");
+
+    typename linkedlist<A, Allocator>::node *stop = linkedlist<A, Allocator>::unwrap(last);
+    if (*link == stop)
+        return linkedlist<A, Allocator>::wrap(last);
+
+    this->digest_invalidate();
+    while (*link != stop)
+    {
+        typename linkedlist<A, Allocator>::node *ptr = *link;
+        *link = ptr->next;
+        this->free_node(ptr);
+        LINKEDLIST_STAT_FREE();
+
+        (this->state->length)--;
+    }
+
+    if (stop == nullptr)
+        this->state->tail = linkedlist<A, Allocator>::unwrap(first);
+
+    return linkedlist<A, Allocator>::wrap(last);
+}
+
+/**
+ * @brief Removes the first `count` values as one batch.
+ *
+ * The boundary is found once and the nodes are moved, not copied, into the
+ * returned list. Fewer values are removed if the list is shorter.
+ *
+ * @param count The number of values to be removed.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::pop_front_n(const size_t &count)
+{
+    LINKEDLIST_TRACE(trace_op::pop_front_n, (uint64_t)count);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(0, std::min(count, this->state->length));
+}
+
+/**
+ * @brief Removes the first `count` values into a vector.
+ *
+ * @param count The number of values to be removed.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::pop_front_n(const size_t &count, std::vector<A> &values)
+{
+    LINKEDLIST_TRACE(trace_op::pop_front_n, (uint64_t)count);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(0, std::min(count, this->state->length), values);
+}
+
+/**
+ * @brief Removes the last `count` values as one batch.
+ *
+ * @param count The number of values to be removed.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::pop_back_n(const size_t &count)
+{
+    LINKEDLIST_TRACE(trace_op::pop_back_n, (uint64_t)count);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(this->state->length - std::min(count, this->state->length), this->state->length);
+}
+
+/**
+ * @brief Removes the last `count` values into a vector.
+ *
+ * @param count The number of values to be removed.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::pop_back_n(const size_t &count, std::vector<A> &values)
+{
+    LINKEDLIST_TRACE(trace_op::pop_back_n, (uint64_t)count);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(this->state->length - std::min(count, this->state->length), this->state->length, values);
+}
+
+/**
+ * @brief Removes `count` values starting at `index` as one batch.
+ *
+ * Fewer values are removed if the list ends first.
+ *
+ * @param index The position of the first value, negative positions count from the end.
+ * @param count The number of values to be removed.
+ * @return A list holding the removed values in order.
+ * @throws INDEX_ERROR If the index is out of range.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::pop_range(const int64_t &index, const size_t &count)
+{
+    LINKEDLIST_TRACE(trace_op::pop_range, index, (uint64_t)count);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    size_t begin = this->offset(index);
+    return this->detach(begin, begin + std::min(count, this->state->length - begin));
+}
+
+/**
+ * @brief Removes `count` values starting at `index` into a vector.
+ *
+ * @param index The position of the first value, negative positions count from the end.
+ * @param count The number of values to be removed.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ * @throws INDEX_ERROR If the index is out of range.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::pop_range(const int64_t &index, const size_t &count, std::vector<A> &values)
+{
+    LINKEDLIST_TRACE(trace_op::pop_range, index, (uint64_t)count);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    size_t begin = this->offset(index);
+    return this->detach(begin, begin + std::min(count, this->state->length - begin), values);
+}
+
+/**
+ * @brief Shortens the list to at most `new_size` values.
+ *
+ * @param new_size The number of values to be kept.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::truncate(const size_t &new_size)
+{
+    LINKEDLIST_TRACE(trace_op::truncate, (uint64_t)new_size);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(std::min(new_size, this->state->length), this->state->length);
+}
+
+/**
+ * @brief Shortens the list to at most `new_size` values, moving the rest into a vector.
+ *
+ * @param new_size The number of values to be kept.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::truncate(const size_t &new_size, std::vector<A> &values)
+{
+    LINKEDLIST_TRACE(trace_op::truncate, (uint64_t)new_size);
+    LINKEDLIST_STAT_SCOPE(list_op::pop);
+
+    return this->detach(std::min(new_size, this->state->length), this->state->length, values);
+}
+
+/**
+ * @brief Unlinks the values at positions `begin` up to, not including, `end`.
+ *
+ * The nodes are relinked into the returned list, which uses this list's
+ * allocator. Nodes in a slab made by compact() or kept inside the list object
+ * cannot leave it, so the values of such a list are moved into new nodes instead.
+ *
+ * @param begin The position of the first value, at most `end`.
+ * @param end The position after the last value, at most `size()`.
+ * @return A list holding the removed values in order.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::detach(size_t begin, size_t end)
+{
+    singly_linked_list<A, Allocator, Inline> removed(this->alloc);
+    if (begin >= end)
+        return removed;
+
+    this->digest_invalidate();
+    typename linkedlist<A, Allocator>::node **link = &this->state->head, *kept = nullptr;
+    for (size_t i = 0; i < begin; i++)
+    {
+        kept = *link;
+        link = &kept->next;
+    }
+    LINKEDLIST_STAT_HOPS(begin);
+
+    if ((this->state->extra != nullptr && this->state->extra->slabs != nullptr) || this->occupancy() > 0)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            typename linkedlist<A, Allocator>::node *ptr = *link;
+            removed.append(std::move(ptr->value));
+
+            *link = ptr->next;
+            this->free_node(ptr);
+            LINKEDLIST_STAT_FREE();
+            (this->state->length)--;
+        }
+    }
+
+    else
+    {
+        typename linkedlist<A, Allocator>::node *first = *link, *last = first;
+        for (size_t i = begin + 1; i < end; i++)
+            last = last->next;
+        LINKEDLIST_STAT_HOPS(end - begin - 1);
+
+        *link = last->next;
+        last->next = nullptr;
+
+        removed.state->head = first;
+        removed.state->tail = last;
+        removed.state->length = end - begin;
+        this->state->length -= end - begin;
+    }
+
+    if (*link == nullptr)
+        this->state->tail = kept;
+
+    return removed;
+}
+
+/**
+ * @brief Removes the values at positions `begin` up to, not including, `end` into a vector.
+ *
+ * @param begin The position of the first value, at most `end`.
+ * @param end The position after the last value, at most `size()`.
+ * @param values The vector the removed values are appended to, in order.
+ * @return The number of values removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::detach(size_t begin, size_t end, std::vector<A> &values)
+{
+    if (begin >= end)
+        return 0;
+
+    values.reserve(values.size() + (end - begin));
+    this->digest_invalidate();
+
+    typename linkedlist<A, Allocator>::node **link = &this->state->head, *kept = nullptr;
+    for (size_t i = 0; i < begin; i++)
+    {
+        kept = *link;
+        link = &kept->next;
+    }
+    LINKEDLIST_STAT_HOPS(begin);
+
+    for (size_t i = begin; i < end; i++)
+    {
+        typename linkedlist<A, Allocator>::node *ptr = *link;
+        values.push_back(std::move(ptr->value));
+
+        *link = ptr->next;
+        this->free_node(ptr);
+        LINKEDLIST_STAT_FREE();
+        (this->state->length)--;
+    }
+
+    if (*link == nullptr)
+        this->state->tail = kept;
+
+    return end - begin;
+}
+
+/**
+ * @brief Checks if the linked list contains a specific value.
+ *
+ * With set_order_tracking(), a list known to be in order stops at the first
+ * value past the one searched for.
+ *
+ * @param value The value to search for in the linked list.
+ * @return true if the value is found, false` otherwise.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::contains(const A &value) const
+{
+    LINKEDLIST_TRACE(trace_op::contains, value);
+    LINKEDLIST_STAT_SCOPE(list_op::contains);
+
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        if (ptr->value == value)
+            return true;
+        if (this->order_passed(ptr->value, value))
+            break;
+        ptr = ptr->next;
+        LINKEDLIST_STAT_HOP();
+    }
+    
+    return false;
+}
+
+/**
+ * @brief Finds the index of the first occurrence of a specific value in the singly linked list.
+ *
+ * This method returns the index of the first node containing the specified value. If the value is not found, an exception is thrown.
+ *
+ * @param value The value to search for.
+ * @return The index of the value in the list if the value is found in the list.
+ * @throws VALUE_ERROR If the list is empty.
+ * @throws VALUE_ERROR If the specified value is not found in the list.
+ */
+template <typename A, typename Allocator, size_t Inline>
+int64_t singly_linked_list<A, Allocator, Inline>::index(const A &value) const
+{
+    LINKEDLIST_TRACE(trace_op::index, value);
+
+    size_t position;
+    if (this->try_index(value, position))
+        return (int64_t)position;
+
+    throw VALUE_ERROR(this->isempty() ? "Index of Element from Empty List" : "Value `x` not in List");
+}
+
+/**
+ * @brief Finds the index of the first occurrence of a value, without throwing.
+ *
+ * With set_order_tracking(), a list known to be in order stops at the first
+ * value past the one searched for.
+ *
+ * @param value The value to search for.
+ * @param index Receives the index of the value; left untouched on a miss.
+ * @return true if the value was found, false otherwise.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::try_index(const A &value, size_t &index) const
+{
+    LINKEDLIST_TRACE(trace_op::try_index, value);
+    LINKEDLIST_STAT_SCOPE(list_op::index);
+
+    size_t curr_index = 0;
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        if (ptr->value == value)
+        {
+            index = curr_index;
+            return true;
+        }
+        if (this->order_passed(ptr->value, value))
+            break;
+
+        ptr = ptr->next;
+        curr_index++;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    return false;
+}
+
+/**
+ * @brief Counts the number of occurrences of a specific value in the singly linked list.
+ *
+ * This method counts how many times the specified value appears in the list.
+ * With set_order_tracking(), a list known to be in order stops at the first
+ * value past the counted one.
+ *
+ * @param value The value to count.
+ * @return The number of occurrences of the value.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::count(const A &value) const
+{
+    LINKEDLIST_TRACE(trace_op::count, value);
+    LINKEDLIST_STAT_SCOPE(list_op::count);
+
+    size_t founds = 0;
+    if (this->isempty())
+        return founds;
+
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr != nullptr)
+    {
+        if (ptr->value == value)
+            founds++;
+        else if (this->order_passed(ptr->value, value))
+            break;
+        ptr = ptr->next;
+        LINKEDLIST_STAT_HOP();
+    }
+
+    return founds;
+}
+
+/**
+ * @brief Reverses the order of nodes in the singly linked list.
+ *
+ * This method reverses the linked list in place.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::reverse()
+{
+    LINKEDLIST_TRACE(trace_op::reverse);
+
+    typename linkedlist<A, Allocator>::node *current = this->state->head, *prev = nullptr, *next_node;
+    this->digest_invalidate();
+    if (this->state->extra != nullptr)
+        std::swap(this->state->extra->ascending, this->state->extra->descending);
+    this->state->tail = this->state->head;
+    while (current != nullptr)
+    {
+        next_node = current->next;
+        current->next = prev;
+        prev = current;
+        current = next_node;
+    }
+
+    this->state->head = prev;
+    this->autocompact();
+}
+
+/**
+ * @brief Sorts the singly linked list in ascending order.
+ *
+ * This method sorts the list using a stable merge sort that relinks the existing
+ * nodes, so no values are copied and no memory is allocated. A list already in
+ * ascending order is left as it is, after at most one pass to check it, and one
+ * in strictly descending order is reversed in a single pass. With
+ * set_order_tracking(), a list known to be ascending is not checked again.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::sort() 
+{
+    LINKEDLIST_TRACE(trace_op::sort);
+
+    if (this->is_sorted())
+        return;
+
+    // Reversing would swap equal values, so only a strictly descending list is reversed
+    if (!this->tracks_order() || this->state->extra == nullptr || this->state->extra->descending)
+    {
+        typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+        while (ptr->next != nullptr && (LINKEDLIST_STAT_COMPARE(), ptr->next->value < ptr->value))
+            ptr = ptr->next;
+
+        if (ptr->next == nullptr)
+        {
+            this->reverse();
+            return;
+        }
+    }
+
+    this->sort([](A &left, A &right) { return !(right <= left); });
+    this->order_sorted();
+}
+
+/**
+ * @brief Sorts the singly linked list by a comparator.
+ *
+ * Same stable merge sort as sort(), ordering by `comp` instead of `<=`, e.g.
+ * by a single field or in descending order.
+ *
+ * @param comp A strict weak ordering; `comp(a, b)` is true if `a` goes before `b`.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename Compare>
+void singly_linked_list<A, Allocator, Inline>::sort(Compare comp)
+{
+    LINKEDLIST_TRACE_RESULT();
+    if (this->state->length < 2)
+        return;
+
+    this->digest_invalidate();
+    this->order_invalidate();
+    this->state->head = singly_linked_list<A, Allocator, Inline>::mergesort(this->state->head, &this->state->tail, comp);
+    this->autocompact();
+}
+
+/**
+ * @brief Sorts the singly linked list by a key computed from each value.
+ *
+ * `key` is called exactly once per element. The keys are cached next to their
+ * node pointers in a scratch array from the list's allocator, which is stably
+ * sorted by key with `<` before the nodes are relinked in that order.
+ *
+ * @param key Maps a value to the key it is ordered by.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename KeyFn>
+void singly_linked_list<A, Allocator, Inline>::sort_by_key(KeyFn key)
+{
+    LINKEDLIST_TRACE_RESULT();
+    typedef typename linkedlist<A, Allocator>::node node;
+    typedef typename std::decay<decltype(key(this->state->head->value))>::type key_type;
+    typedef std::pair<key_type, node *> entry;
+
+    if (this->state->length < 2)
+        return;
+
+    this->digest_invalidate();
+    this->order_invalidate();
+    std::vector<entry, typename std::allocator_traits<Allocator>::template rebind_alloc<entry>> entries(this->alloc);
+    entries.reserve(this->state->length);
+    for (node *ptr = this->state->head; ptr != nullptr; ptr = ptr->next)
+        entries.emplace_back(key(ptr->value), ptr);
+
+    std::stable_sort(entries.begin(), entries.end(), [](const entry &left, const entry &right)
+    {
+        LINKEDLIST_STAT_COMPARE();
+        return left.first < right.first;
+    });
+
+    for (size_t i = 1; i < entries.size(); i++)
+        entries[i - 1].second->next = entries[i].second;
+
+    entries.back().second->next = nullptr;
+    this->state->head = entries.front().second;
+    this->state->tail = entries.back().second;
+    this->autocompact();
+}
+
+/**
+ * @brief Sorts a list of integers or floating-point numbers with an LSD radix sort.
+ *
+ * Each pass distributes the nodes into 256 buckets by one byte of their key,
+ * relinking `next` pointers, and splices the buckets back together in order.
+ * Bytes that are the same in every key are skipped, so, for example, 64-bit
+ * timestamps from the same period need far fewer than 8 passes. The sort is
+ * stable, copies no values and uses no memory beyond the bucket heads and tails.
+ *
+ * Negative numbers sort before positive ones and floating-point values follow
+ * IEEE-754 order, with -0.0 before 0.0; NaNs go after +inf, or before -inf if
+ * their sign bit is set.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::radix_sort()
+{
+    static_assert(std::is_integral<A>::value || std::is_floating_point<A>::value, "radix_sort() requires an integral or floating-point element type");
+    static_assert(sizeof(A) == sizeof(radix_type), "radix_sort() supports element types of 1, 2, 4 or 8 bytes");
+
+    LINKEDLIST_TRACE_RESULT();
+    typedef typename linkedlist<A, Allocator>::node node;
+
+    if (this->state->length < 2)
+        return;
+
+    this->digest_invalidate();
+    this->order_invalidate();
+    radix_type first = singly_linked_list<A, Allocator, Inline>::radix_key(this->state->head->value, std::is_floating_point<A>()), differing = 0;
+    for (node *ptr = this->state->head->next; ptr != nullptr; ptr = ptr->next)
+        differing |= singly_linked_list<A, Allocator, Inline>::radix_key(ptr->value, std::is_floating_point<A>()) ^ first;
+
+    node *heads[256], *tails[256];
+    for (size_t shift = 0; shift < sizeof(radix_type) * 8; shift += 8)
+    {
+        if (((differing >> shift) & 0xFF) == 0)
+            continue;
+
+        std::fill(heads, heads + 256, nullptr);
+        for (node *ptr = this->state->head; ptr != nullptr; ptr = ptr->next)
+        {
+            size_t bucket = (singly_linked_list<A, Allocator, Inline>::radix_key(ptr->value, std::is_floating_point<A>()) >> shift) & 0xFF;
+            if (heads[bucket] == nullptr)
+                heads[bucket] = ptr;
+            else
+                tails[bucket]->next = ptr;
+            tails[bucket] = ptr;
+        }
+
+        node **link = &this->state->head;
+        for (size_t bucket = 0; bucket < 256; bucket++)
+        {
+            if (heads[bucket] == nullptr)
+                continue;
+
+            *link = heads[bucket];
+            link = &tails[bucket]->next;
+            this->state->tail = tails[bucket];
+        }
+
+        *link = nullptr;
+    }
+
+    this->order_sorted();
+    this->autocompact();
+}
+
+/**
+ * @brief Checks whether the list is in ascending order.
+ *
+ * Checks in one pass. With set_order_tracking(), the list keeps track of
+ * whether it is in ascending or descending order as values are added, so this
+ * is O(1) for a list built in order, e.g. with insert_in_order(), or sorted
+ * since it last changed, and the result of a pass is remembered until the
+ * list changes. Writing through operator[], try_at() or a non-const iterator
+ * makes the order unknown again.
+ *
+ * @return true if no value is greater than the one after it.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::is_sorted() const
+{
+    if (this->tracks_order() && this->state->extra != nullptr && this->state->extra->ascending)
+        return true;
+
+    bool ascending = true, descending = true;
+    for (typename linkedlist<A, Allocator>::node *ptr = this->state->head; ptr != nullptr && ptr->next != nullptr && (ascending || descending); ptr = ptr->next)
+    {
+        LINKEDLIST_STAT_COMPARE();
+        if (!(ptr->value <= ptr->next->value))
+            ascending = false;
+        if (!(ptr->value >= ptr->next->value))
+            descending = false;
+    }
+
+    if (this->tracks_order())
+    {
+        typename linkedlist<A, Allocator>::extension &extra = this->extras();
+        extra.ascending = ascending;
+        extra.descending = descending;
+    }
+
+    return ascending;
+}
+
+/**
+ * @brief Maps a floating-point value to an unsigned key with the same order.
+ *
+ * Negative values have all their bits flipped, so larger magnitudes come first;
+ * non-negative values only have the sign bit set, so they follow.
+ *
+ * @param value The value to map.
+ * @return The key, compared as an unsigned integer.
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename singly_linked_list<A, Allocator, Inline>::radix_type singly_linked_list<A, Allocator, Inline>::radix_key(const A &value, std::true_type)
+{
+    const radix_type sign = (radix_type)1 << (sizeof(radix_type) * 8 - 1);
+
+    radix_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    return (bits & sign) ? (radix_type)~bits : (radix_type)(bits | sign);
+}
+
+/**
+ * @brief Maps an integer to an unsigned key with the same order.
+ *
+ * Signed values have their sign bit flipped, so negative values come first.
+ *
+ * @param value The value to map.
+ * @return The key, compared as an unsigned integer.
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename singly_linked_list<A, Allocator, Inline>::radix_type singly_linked_list<A, Allocator, Inline>::radix_key(const A &value, std::false_type)
+{
+    const radix_type sign = std::is_signed<A>::value ? (radix_type)1 << (sizeof(radix_type) * 8 - 1) : 0;
+
+    return (radix_type)value ^ sign;
+}
+
+/**
+ * @brief Sorts a chain of nodes with a bottom-up merge sort.
+ *
+ * Runs of width 1, 2, 4, ... are merged pairwise until a single run is left,
+ * so the stack depth stays constant whatever the length of the chain.
+ *
+ * @param head The head of the chain to be sorted.
+ * @param tail Receives the last node of the sorted chain.
+ * @param comp The ordering passed on to merge().
+ * @return The head of the sorted chain.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename Compare>
+typename linkedlist<A, Allocator>::node *singly_linked_list<A, Allocator, Inline>::mergesort(typename linkedlist<A, Allocator>::node *head, typename linkedlist<A, Allocator>::node **tail, Compare comp)
+{
+    for (size_t width = 1; ; width *= 2)
+    {
+        typename linkedlist<A, Allocator>::node *remaining = head, *sorted = nullptr, **link = &sorted;
+        size_t merges = 0;
+        while (remaining != nullptr)
+        {
+            typename linkedlist<A, Allocator>::node *left = remaining, *right = remaining;
+            for (size_t i = 1; i < width && right->next != nullptr; i++)
+                right = right->next;
+
+            typename linkedlist<A, Allocator>::node *left_end = right;
+            right = right->next;
+            left_end->next = nullptr;
+
+            remaining = right;
+            for (size_t i = 1; i < width && remaining != nullptr; i++)
+                remaining = remaining->next;
+
+            if (remaining != nullptr)
+            {
+                typename linkedlist<A, Allocator>::node *next_run = remaining->next;
+                remaining->next = nullptr;
+                remaining = next_run;
+            }
+
+            *link = singly_linked_list<A, Allocator, Inline>::merge(left, right, comp);
+            while ((*link)->next != nullptr)
+                link = &(*link)->next;
+
+            *tail = *link;
+            link = &(*link)->next;
+            merges++;
+        }
+
+        head = sorted;
+        if (merges <= 1)
+            return head;
+    }
+}
+
+/**
+ * @brief Merges two sorted chains of nodes into one sorted chain.
+ *
+ * Equal values keep their order, `left` first.
+ *
+ * @param left The head of the first sorted chain.
+ * @param right The head of the second sorted chain.
+ * @param comp A strict weak ordering; a node of `right` is taken first only if it compares less.
+ * @return The head of the merged sorted chain.
+ */
+template <typename A, typename Allocator, size_t Inline>
+template <typename Compare>
+typename linkedlist<A, Allocator>::node *singly_linked_list<A, Allocator, Inline>::merge(typename linkedlist<A, Allocator>::node *left, typename linkedlist<A, Allocator>::node *right, Compare comp)
+{
+    typename linkedlist<A, Allocator>::node *merged = nullptr, **link = &merged;
+    while (left != nullptr && right != nullptr)
+    {
+        LINKEDLIST_STAT_COMPARE();
+        if (!comp(right->value, left->value))
+        {
+            *link = left;
+            left = left->next;
+        }
+
+        else
+        {
+            *link = right;
+            right = right->next;
+        }
+
+        link = &(*link)->next;
+    }
+
+    *link = (left != nullptr) ? left : right;
+
+    return merged;
+}
+
+/**
+ * @brief Removes adjacent duplicate values in a single pass.
+ *
+ * Only the first value of each run of equal values is kept, so a sorted list
+ * ends up with no duplicates at all.
+ *
+ * @return The number of nodes removed.
+ */
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::unique()
+{
+    LINKEDLIST_TRACE_RESULT();
+    size_t removed = 0;
+    if (this->isempty())
+        return removed;
+
+    this->digest_invalidate();
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    while (ptr->next != nullptr)
+    {
+        LINKEDLIST_STAT_COMPARE();
+        if (!(ptr->next->value == ptr->value))
+        {
+            ptr = ptr->next;
+            LINKEDLIST_STAT_HOP();
+            continue;
+        }
+
+        typename linkedlist<A, Allocator>::node *duplicate = ptr->next;
+        ptr->next = duplicate->next;
+        if (duplicate == this->state->tail)
+            this->state->tail = ptr;
+
+        this->free_node(duplicate);
+        LINKEDLIST_STAT_FREE();
+
+        (this->state->length)--;
+        removed++;
+    }
+
+    return removed;
+}
+
+/**
+ * @brief Computes the union of two sorted lists.
+ *
+ * Returns, in ascending order, the values that are in either list. A value occurring m times in one list and n times in the other occurs max(m, n) times. Both lists must be sorted
+ * ascending; each is walked once. The lists are left unchanged.
+ *
+ * @param obj The other sorted list.
+ * @return A new list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_union(const singly_linked_list<A, Allocator, Inline> &obj) const &
+{
+    return singly_linked_list<A, Allocator, Inline>::combine(*this, obj, true, true, true);
+}
+
+/**
+ * @brief Computes the union of two sorted lists by relinking their nodes.
+ *
+ * Same result as the copying overload, but both lists are consumed: the
+ * result reuses their nodes, the rest are freed, and both are left empty.
+ * Called as `std::move(a).set_union(std::move(b))`.
+ *
+ * @param obj The other sorted list.
+ * @return The list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_union(singly_linked_list<A, Allocator, Inline> &&obj) &&
+{
+    LINKEDLIST_TRACE(trace_op::clear);
+    list_trace_scope emptied(obj.tracer(), trace_op::clear);
+    return singly_linked_list<A, Allocator, Inline>::combine(std::move(*this), std::move(obj), true, true, true);
+}
+
+/**
+ * @brief Computes the intersection of two sorted lists.
+ *
+ * Returns, in ascending order, the values that are in both lists, min(m, n) times for a value occurring m and n times. Both lists must be sorted
+ * ascending; each is walked once. The lists are left unchanged.
+ *
+ * @param obj The other sorted list.
+ * @return A new list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_intersection(const singly_linked_list<A, Allocator, Inline> &obj) const &
+{
+    return singly_linked_list<A, Allocator, Inline>::combine(*this, obj, false, false, true);
+}
+
+/**
+ * @brief Computes the intersection of two sorted lists by relinking their nodes.
+ *
+ * Same result as the copying overload, but both lists are consumed: the
+ * result reuses their nodes, the rest are freed, and both are left empty.
+ * Called as `std::move(a).set_intersection(std::move(b))`.
+ *
+ * @param obj The other sorted list.
+ * @return The list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_intersection(singly_linked_list<A, Allocator, Inline> &&obj) &&
+{
+    LINKEDLIST_TRACE(trace_op::clear);
+    list_trace_scope emptied(obj.tracer(), trace_op::clear);
+    return singly_linked_list<A, Allocator, Inline>::combine(std::move(*this), std::move(obj), false, false, true);
+}
+
+/**
+ * @brief Computes the difference of two sorted lists.
+ *
+ * Returns, in ascending order, the values of this list that are not in `obj`, max(m - n, 0) times for a value occurring m times here and n times in `obj`. Both lists must be sorted
+ * ascending; each is walked once. The lists are left unchanged.
+ *
+ * @param obj The other sorted list.
+ * @return A new list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_difference(const singly_linked_list<A, Allocator, Inline> &obj) const &
+{
+    return singly_linked_list<A, Allocator, Inline>::combine(*this, obj, true, false, false);
+}
+
+/**
+ * @brief Computes the difference of two sorted lists by relinking their nodes.
+ *
+ * Same result as the copying overload, but both lists are consumed: the
+ * result reuses their nodes, the rest are freed, and both are left empty.
+ * Called as `std::move(a).set_difference(std::move(b))`.
+ *
+ * @param obj The other sorted list.
+ * @return The list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_difference(singly_linked_list<A, Allocator, Inline> &&obj) &&
+{
+    LINKEDLIST_TRACE(trace_op::clear);
+    list_trace_scope emptied(obj.tracer(), trace_op::clear);
+    return singly_linked_list<A, Allocator, Inline>::combine(std::move(*this), std::move(obj), true, false, false);
+}
+
+/**
+ * @brief Computes the symmetric difference of two sorted lists.
+ *
+ * Returns, in ascending order, the values that are in exactly one of the lists, |m - n| times for a value occurring m and n times. Both lists must be sorted
+ * ascending; each is walked once. The lists are left unchanged.
+ *
+ * @param obj The other sorted list.
+ * @return A new list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_symmetric_difference(const singly_linked_list<A, Allocator, Inline> &obj) const &
+{
+    return singly_linked_list<A, Allocator, Inline>::combine(*this, obj, true, true, false);
+}
+
+/**
+ * @brief Computes the symmetric difference of two sorted lists by relinking their nodes.
+ *
+ * Same result as the copying overload, but both lists are consumed: the
+ * result reuses their nodes, the rest are freed, and both are left empty.
+ * Called as `std::move(a).set_symmetric_difference(std::move(b))`.
+ *
+ * @param obj The other sorted list.
+ * @return The list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::set_symmetric_difference(singly_linked_list<A, Allocator, Inline> &&obj) &&
+{
+    LINKEDLIST_TRACE(trace_op::clear);
+    list_trace_scope emptied(obj.tracer(), trace_op::clear);
+    return singly_linked_list<A, Allocator, Inline>::combine(std::move(*this), std::move(obj), true, true, false);
+}
+
+/**
+ * @brief Unlinks the head node without freeing it.
+ *
+ * @return The unlinked node.
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::node *singly_linked_list<A, Allocator, Inline>::pop_head()
+{
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    this->state->head = ptr->next;
+    if (this->state->head == nullptr)
+        this->state->tail = nullptr;
+
+    (this->state->length)--;
+
+    return ptr;
+}
+
+/**
+ * @brief Moves the head node of one list to a given link of another.
+ *
+ * The node itself is moved when `relink` is set; otherwise its value is moved
+ * into a node allocated by `to` and the original node is freed.
+ *
+ * @param to The list receiving the node.
+ * @param from The list giving up its head node.
+ * @param link The next pointer in `to` that the node is linked into.
+ * @param relink Whether the node can be moved as is.
+ * @return The node now linked into `to`.
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::node *singly_linked_list<A, Allocator, Inline>::adopt(singly_linked_list<A, Allocator, Inline> &to, singly_linked_list<A, Allocator, Inline> &from, typename linkedlist<A, Allocator>::node **link, const bool &relink)
+{
+    typename linkedlist<A, Allocator>::node *ptr;
+    if (relink)
+        ptr = from.pop_head();
+
+    else
+    {
+        ptr = to.alloc_node();
+        LINKEDLIST_STAT_ALLOC();
+
+        ptr->value = std::move(from.state->head->value);
+        from.free_node(from.pop_head());
+        LINKEDLIST_STAT_FREE();
+    }
+
+    ptr->next = *link;
+    *link = ptr;
+    (to.state->length)++;
+
+    return ptr;
+}
+
+/**
+ * @brief Merges two sorted lists into a new list, keeping the selected values.
+ *
+ * Walks both lists once, like merge(). A value smaller than the head of the
+ * other list is copied if its side is kept; equal heads are copied once if
+ * `keep_equal` and both advance. Whatever remains of a side at the end is
+ * copied if that side is kept.
+ *
+ * @param left The first sorted list.
+ * @param right The second sorted list.
+ * @param keep_left Whether values only in `left` are kept.
+ * @param keep_right Whether values only in `right` are kept.
+ * @param keep_equal Whether values in both lists are kept.
+ * @return A new list using a copy of `left`'s allocator.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::combine(const singly_linked_list<A, Allocator, Inline> &left, const singly_linked_list<A, Allocator, Inline> &right, const bool &keep_left, const bool &keep_right, const bool &keep_equal)
+{
+    singly_linked_list<A, Allocator, Inline> result(std::allocator_traits<Allocator>::select_on_container_copy_construction(left.alloc));
+
+    typename linkedlist<A, Allocator>::node *l = left.state->head, *r = right.state->head;
+    while (l != nullptr && r != nullptr)
+    {
+        LINKEDLIST_STAT_COMPARE();
+        if (l->value < r->value)
+        {
+            if (keep_left)
+                result.append(l->value);
+            l = l->next;
+        }
+
+        else if (r->value < l->value)
+        {
+            if (keep_right)
+                result.append(r->value);
+            r = r->next;
+        }
+
+        else
+        {
+            if (keep_equal)
+                result.append(l->value);
+            l = l->next;
+            r = r->next;
+        }
+    }
+
+    for (; keep_left && l != nullptr; l = l->next)
+        result.append(l->value);
+
+    for (; keep_right && r != nullptr; r = r->next)
+        result.append(r->value);
+
+    return result;
+}
+
+/**
+ * @brief Merges two sorted lists by relinking their nodes, keeping the selected values.
+ *
+ * The result takes over `left`'s nodes and allocator and the kept nodes of
+ * `right` are linked into it; nodes that are not kept are freed. Nodes of
+ * `right` are copied instead of relinked if its allocator differs, it was
+ * compacted or it keeps nodes inline. Both lists are left empty; lists
+ * sharing their nodes see that too.
+ *
+ * @param left The first sorted list.
+ * @param right The second sorted list.
+ * @param keep_left Whether values only in `left` are kept.
+ * @param keep_right Whether values only in `right` are kept.
+ * @param keep_equal Whether values in both lists are kept.
+ * @return The list holding the result.
+ */
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::combine(singly_linked_list<A, Allocator, Inline> &&left, singly_linked_list<A, Allocator, Inline> &&right, const bool &keep_left, const bool &keep_right, const bool &keep_equal)
+{
+    typedef typename linkedlist<A, Allocator>::node node;
+
+    if (left.state == right.state)
+    {
+        singly_linked_list<A, Allocator, Inline> result = singly_linked_list<A, Allocator, Inline>::combine(static_cast<const singly_linked_list<A, Allocator, Inline> &>(left), static_cast<const singly_linked_list<A, Allocator, Inline> &>(right), keep_left, keep_right, keep_equal);
+        left.clear();
+
+        return result;
+    }
+
+    singly_linked_list<A, Allocator, Inline> result(std::move(left));
+    result.digest_invalidate();
+    right.digest_invalidate();
+    result.order_invalidate();
+    const bool relink = (right.state->extra == nullptr || right.state->extra->slabs == nullptr) && right.occupancy() == 0 && right.alloc == result.alloc;
+
+    // `link` is the next pointer the following kept node goes into; the rest of left stays linked after it
+    node **link = &result.state->head, *last = nullptr;
+    while (*link != nullptr && right.state->head != nullptr)
+    {
+        node *l = *link, *r = right.state->head;
+        LINKEDLIST_STAT_COMPARE();
+        if (r->value < l->value)
+        {
+            if (keep_right)
+            {
+                last = singly_linked_list<A, Allocator, Inline>::adopt(result, right, link, relink);
+                link = &last->next;
+            }
+
+            else
+            {
+                right.free_node(right.pop_head());
+                LINKEDLIST_STAT_FREE();
+            }
+
+            continue;
+        }
+
+        const bool equal = !(l->value < r->value);
+        if (equal ? keep_equal : keep_left)
+        {
+            last = l;
+            link = &l->next;
+        }
+
+        else
+        {
+            *link = l->next;
+            result.free_node(l);
+            LINKEDLIST_STAT_FREE();
+
+            (result.state->length)--;
+        }
+
+        if (equal)
+        {
+            right.free_node(right.pop_head());
+            LINKEDLIST_STAT_FREE();
+        }
+    }
+
+    if (*link != nullptr)
+    {
+        if (keep_left)
+            return result;
+
+        while (*link != nullptr)
+        {
+            node *l = *link;
+            *link = l->next;
+            result.free_node(l);
+            LINKEDLIST_STAT_FREE();
+
+            (result.state->length)--;
+        }
+    }
+
+    if (keep_right && relink && right.state->head != nullptr)
+    {
+        *link = right.state->head;
+        last = right.state->tail;
+        result.state->length += right.state->length;
+
+        right.state->head = right.state->tail = nullptr;
+        right.state->length = 0;
+    }
+
+    for (; keep_right && right.state->head != nullptr; link = &last->next)
+        last = singly_linked_list<A, Allocator, Inline>::adopt(result, right, link, relink);
+
+    right.clear();
+    result.state->tail = last;
+
+    return result;
+}
+
+/**
+ * @brief Moves every node into one contiguous slab, in list order.
+ *
+ * After many inserts, removals and sorts, consecutive nodes are scattered over
+ * the heap and every hop of a traversal is likely a cache miss. compact()
+ * allocates a single array of `size()` nodes from the list's allocator, moves the
+ * values into it front to back and frees the old nodes, so a traversal then
+ * reads memory sequentially. Values added later are allocated one by one as
+ * usual; a slab is freed once all of its nodes have been removed.
+ *
+ * All iterators and references into the list are invalidated. Lists sharing
+ * the nodes of this one see the compacted nodes as well.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::compact()
+{
+    typedef typename linkedlist<A, Allocator>::node node;
+    typedef typename linkedlist<A, Allocator>::slab slab;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<node> node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    const size_t length = this->state->length;
+    if (length == 0)
+        return;
+
+    node_allocator alloc(this->alloc);
+    node *nodes = node_traits::allocate(alloc, length);
+
+    size_t constructed = 0;
+    try
+    {
+        for (; constructed < length; constructed++)
+            node_traits::construct(alloc, nodes + constructed);
+    }
+    catch (...)
+    {
+        while (constructed > 0)
+            node_traits::destroy(alloc, nodes + --constructed);
+        node_traits::deallocate(alloc, nodes, length);
+        throw;
+    }
+
+    slab *block = nullptr;
+    try
+    {
+        block = this->template allocate<slab>();
+    }
+    catch (...)
+    {
+        for (size_t i = 0; i < length; i++)
+            node_traits::destroy(alloc, nodes + i);
+        node_traits::deallocate(alloc, nodes, length);
+        throw;
+    }
+
+    node *ptr = this->state->head;
+    for (size_t i = 0; i < length; i++)
+    {
+        LINKEDLIST_STAT_ALLOC();
+        nodes[i].value = std::move(ptr->value);
+        nodes[i].next = (i + 1 < length) ? nodes + i + 1 : nullptr;
+
+        node *temp = ptr;
+        ptr = ptr->next;
+        this->free_node(temp);
+        LINKEDLIST_STAT_FREE();
+    }
+
+    block->nodes = nodes;
+    block->capacity = block->live = length;
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
+    block->next = extra.slabs;
+    extra.slabs = block;
+
+    this->state->head = nodes;
+    this->state->tail = nodes + length - 1;
+}
+
+/**
+ * @brief Measures how scattered the nodes of the list are.
+ *
+ * Counts the links that do not lead to the node stored directly after the
+ * current one in memory. This takes one pass over the list.
+ *
+ * @return 0.0 for a list laid out in traversal order, up to 1.0 when no node
+ *         follows its predecessor in memory.
+ */
+template <typename A, typename Allocator, size_t Inline>
+double singly_linked_list<A, Allocator, Inline>::fragmentation() const
+{
+    if (this->state->length < 2)
+        return 0.0;
+
+    size_t breaks = 0;
+    for (typename linkedlist<A, Allocator>::node *ptr = this->state->head; ptr->next != nullptr; ptr = ptr->next)
+        if (ptr->next != ptr + 1)
+            breaks++;
+
+    return (double)breaks / (double)(this->state->length - 1);
+}
+
+/**
+ * @brief Enables automatic compaction.
+ *
+ * After sort() and reverse(), which already visit every node, the list measures
+ * its fragmentation() and calls compact() when it exceeds `threshold`. The
+ * setting belongs to this list object and is not copied with it.
+ *
+ * @param threshold The fragmentation above which the list compacts itself,
+ *                  or 0.0 (the default) to disable automatic compaction.
+ * @throws VALUE_ERROR If the threshold is not within [0.0, 1.0].
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::set_compaction_threshold(const double &threshold)
+{
+    if (!(threshold >= 0.0 && threshold <= 1.0))
+        throw VALUE_ERROR("Compaction threshold must be within [0, 1]");
+
+    this->configure().compaction_threshold = threshold;
+}
+
+/**
+ * @brief Gets the opt-in settings of this list, allocating them on first use.
+ *
+ * A list left at its defaults never allocates them, so every setting reads as
+ * off while they are absent.
+ *
+ * @return The settings of this list object.
+ */
+template <typename A, typename Allocator, size_t Inline>
+typename singly_linked_list<A, Allocator, Inline>::settings &singly_linked_list<A, Allocator, Inline>::configure()
+{
+    if (this->options == nullptr)
+        this->options = this->template allocate<settings>();
+
+    return *this->options;
+}
+
+/**
+ * @brief Moves the settings into memory from the allocator this list is about to adopt.
+ *
+ * Must be called before the allocator itself is replaced, while the old one
+ * can still free them.
+ *
+ * @param to The allocator this list adopts.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::propagate_options(const Allocator &to)
+{
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<settings> settings_allocator;
+    typedef std::allocator_traits<settings_allocator> settings_traits;
+
+    if (this->options == nullptr || this->alloc == to)
+        return;
+
+    settings_allocator alloc(to);
+    settings *moved = settings_traits::allocate(alloc, 1);
+    settings_traits::construct(alloc, moved, *this->options);
+
+    this->deallocate(this->options);
+    this->options = moved;
+}
+
+/**
+ * @brief Checks whether set_hash_tracking() is enabled on this list.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::tracks_hash() const
+{
+    return this->options != nullptr && this->options->hash_tracking;
+}
+
+/**
+ * @brief Checks whether set_order_tracking() is enabled on this list.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::tracks_order() const
+{
+    return this->options != nullptr && this->options->order_tracking;
+}
+
+/**
+ * @brief Gets the recorder set with set_trace(), or nullptr while not traced.
+ */
+template <typename A, typename Allocator, size_t Inline>
+list_trace *singly_linked_list<A, Allocator, Inline>::tracer() const
+{
+    return (this->options != nullptr) ? this->options->trace : nullptr;
+}
+
+/**
+ * @brief Compacts the list if automatic compaction is enabled and due.
  */
-template <typename A>
-void singly_linked_list<A>::extend(const std::initializer_list<A> &values)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::autocompact()
 {
-    for (const A &value: values)
-        this->append(value);
+    if (this->options != nullptr && this->options->compaction_threshold > 0.0 && this->fragmentation() > this->options->compaction_threshold)
+        this->compact();
 }
 
 /**
- * @brief Extends the singly linked list with the contents of an array.
+ * @brief Enables or disables incremental maintenance of the list's hash.
  *
- * This method appends the values from the provided array to the current list.
+ * While enabled, append(), prepend() and pops at either end update the cached
+ * hash in O(1); other mutations mark it stale and the next hash() or
+ * comparison recomputes it once. Lists that both track their hash then compare
+ * unequal in O(1) when the hashes differ. Values written through a reference or
+ * iterator obtained before the hash was last brought up to date are not
+ * noticed, and make such comparisons wrong. While disabled, which is the
+ * default, every mutation marks the hash stale and `==` never relies on it.
  *
- * @tparam N The size of the array.
- * @param array An array containing the values to be appended.
+ * @param enabled Whether to maintain the hash.
  */
-template <typename A>
-template <size_t N>
-void singly_linked_list<A>::extend(const A (&array)[N])
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::set_hash_tracking(const bool &enabled)
 {
-    for (const A &value: array)
-        this->append(value);
+    static_assert(linkedlist<A, Allocator>::template hashable<A>(0), "Hashing a list requires std::hash of its element type");
+
+    this->configure().hash_tracking = enabled;
+    if (enabled)
+        this->digest();
 }
 
 /**
- * @brief Extends the singly linked list with the contents of a vector.
- *
- * This method appends the values from the provided vector to the current list.
- *
- * @param values A vector containing the values to be appended.
+ * @brief Enables or disables tracking of whether the list is in order.
+ *
+ * While enabled, the list remembers whether it is in ascending or descending
+ * order as values are added, sorted or removed. `contains`, `index`,
+ * `try_index` and `count` then stop at the first value past the one searched
+ * for, `min` and `max` read the head or tail, and `is_sorted()` and `sort()`
+ * return at once on a list known to be ascending. Values written through a
+ * reference or iterator obtained before the order was last established are
+ * not noticed, and make these answers wrong. While disabled, which is the
+ * default, the order is never assumed.
+ *
+ * @param enabled Whether to track the order.
  */
-template <typename A>
-void singly_linked_list<A>::extend(const std::vector<A> &values)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::set_order_tracking(const bool &enabled)
 {
-    for (typename std::vector<A>::const_iterator it = values.begin(); it != values.end(); it++)
-        this->append(*it);
+    this->configure().order_tracking = enabled;
+    if (enabled)
+        this->is_sorted();
+    else
+        this->order_invalidate();
 }
 
 /**
- * @brief Removes the first occurrence of a specific value from the singly linked list.
+ * @brief Returns an order-sensitive hash of the values, built on `std::hash<A>`.
  *
- * This method removes the first node containing the specified value. If the value is not found, an exception is thrown.
+ * The hash is cached until the list is next modified, or kept up to date with
+ * set_hash_tracking(). Values written through a reference or iterator obtained
+ * before the last call are not noticed.
  *
- * @param value The value to be removed.
- * @throws VALUE_ERROR If the list is empty or the value is not found.
+ * @return The hash of the list.
  */
-template <typename A>
-void singly_linked_list<A>::remove(const A &value)
+template <typename A, typename Allocator, size_t Inline>
+size_t singly_linked_list<A, Allocator, Inline>::hash() const
 {
-    if (this->isempty())
-        throw VALUE_ERROR("Removing from Empty List");
+    static_assert(linkedlist<A, Allocator>::template hashable<A>(0), "Hashing a list requires std::hash of its element type");
 
-    typename linkedlist<A>::node *ptr = *this->head;
-    if (ptr->value == value)
-    {
-        *this->head = ptr->next;
-        delete ptr;
+    return this->digest();
+}
 
-        *this->head = *this->tail = nullptr;
-        (*this->length)--;
-        return;
-    }
+/**
+ * @brief Starts or stops recording the calls made on the list.
+ *
+ * While a recorder is attached, each call of `append`, `prepend`, `insert`,
+ * `insert_in_order`, `extend`, `extend_parallel`, `remove`, `remove_all`, `erase`,
+ * `pop`, the `try_` variants, `contains`, `index`, `count`, `operator[]`,
+ * `reverse`, `sort()`, `clear`, `pop_front_n`, `pop_back_n`, `pop_range`,
+ * `truncate`, `insert_after` and `erase_after` is written to it with its
+ * arguments, before it runs. Iterators are written as positions, which costs a
+ * walk from the head. Calls a replay cannot repeat, taking a predicate,
+ * comparator or key, or missing from doubly_linked_list, are recorded as a
+ * `clear` and an `extend` of the values they leave: `remove_if`, `sort(comp)`,
+ * `sort_by_key`, `radix_sort`, `unique` and assignments. Moving from the list,
+ * including the consuming set operations, records a `clear`. Calls these make
+ * internally are not recorded, and neither is `compact()`, which changes no
+ * values. The current contents are recorded first as an `extend`, so a replay
+ * can start from an empty list. Writes through references and iterators, and
+ * changes made through copies sharing the nodes, are not seen. The recorder
+ * must stay alive while it is attached.
+ *
+ * @param trace The recorder to write to, or nullptr to stop recording.
+ * @throws TYPE_ERROR If the recorder already holds calls on a different value type.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::set_trace(list_trace *trace)
+{
+    static_assert(std::is_trivially_copyable<A>::value, "Tracing a list requires a trivially copyable element type");
 
-    while (ptr->next != nullptr)
+    if (trace != nullptr)
     {
-        if (ptr->next->value == value)
-            break;
-        ptr = ptr->next;
+        trace->template attach<A>();
+        if (!this->isempty())
+            trace->record(trace_op::extend, make_trace_range(this->cbegin(), this->cend(), this->size()));
     }
 
-    if (ptr->next == nullptr)
-        throw VALUE_ERROR("Removing `x`, non-element in the List");
-
-    if (ptr->next == *this->tail)
-        *this->tail = ptr;
-
-    typename linkedlist<A>::node *temp = ptr->next;
-    ptr->next = temp->next;
-    delete temp;
-    
-    temp = nullptr;
-    (*this->length)--;
+    this->configure().trace = trace;
 }
 
 /**
- * @brief Pops and returns the value at a specific index from the singly linked list.
- *
- * This method removes and returns the node at the specified index. Negative indices count from the end.
+ * @brief Gets the position a trace records for an iterator.
  *
- * @param index The index of the node to be popped.
- * @return The value of the node at the specified index.
- * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ * @param pos The iterator.
+ * @return The number of values up to and including `pos`: 0 for before_begin()
+ * and `size() + 1` for end(). Always 0 while the list is not traced.
  */
-template <typename A>
-A singly_linked_list<A>::pop(const int64_t &index)
+template <typename A, typename Allocator, size_t Inline>
+int64_t singly_linked_list<A, Allocator, Inline>::trace_position(const typename linkedlist<A, Allocator>::const_iterator &pos) const
 {
-    if (this->isempty())
-        throw INDEX_ERROR("Pop from Empty List");
+    if (this->tracer() == nullptr)
+        return 0;
 
-    if (index < -(int64_t)(this->size()) || index >= (int64_t)(this->size()))
-        throw INDEX_ERROR("Pop index out of range");
+    typename linkedlist<A, Allocator>::node **link = linkedlist<A, Allocator>::getlink(pos);
+    if (link == nullptr)
+        return (int64_t)this->state->length + 1;
+    if (link == &this->state->head)
+        return 0;
 
-    typename linkedlist<A>::node *ptr = *this->head;
-    if (index == 0L || index == -(int64_t)(this->size()))
-    {
-        A value = ptr->value;
-        *this->head = ptr->next;
-        delete ptr;
+    int64_t position = 1;
+    for (typename linkedlist<A, Allocator>::node *ptr = this->state->head; ptr != linkedlist<A, Allocator>::unwrap(pos); ptr = ptr->next)
+        position++;
 
-        *this->head = nullptr;
-        if (this->isempty())
-            *this->tail = nullptr;
+    return position;
+}
 
-        (*this->length)--;
-        return value;
+/**
+ * @brief Accounts for a value appended to the list in the cached hash.
+ * @param value The appended value.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::digest_append(const A &value)
+{
+    if (!this->tracks_hash() || this->state->extra == nullptr || !this->state->extra->digest_valid)
+    {
+        this->digest_invalidate();
+        return;
     }
 
-    int64_t curr_index = 0L;
-    if (index < 0L)
-        curr_index = -(int64_t)(this->size());
+    typename linkedlist<A, Allocator>::extension &extra = *this->state->extra;
+    extra.digest = extra.digest * linkedlist<A, Allocator>::digest_base + linkedlist<A, Allocator>::digest_term(value);
+    extra.digest_power *= linkedlist<A, Allocator>::digest_base;
+}
 
-    while (curr_index != index - 1L)
+/**
+ * @brief Accounts for a value prepended to the list in the cached hash.
+ * @param value The prepended value.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::digest_prepend(const A &value)
+{
+    if (!this->tracks_hash() || this->state->extra == nullptr || !this->state->extra->digest_valid)
     {
-        ptr = ptr->next;
-        curr_index++;
+        this->digest_invalidate();
+        return;
     }
-    
-    if (ptr->next == *this->tail)
-        *this->tail = ptr;
 
-    typename linkedlist<A>::node *temp = ptr->next;
-    ptr->next = temp->next;
+    typename linkedlist<A, Allocator>::extension &extra = *this->state->extra;
+    extra.digest += linkedlist<A, Allocator>::digest_term(value) * extra.digest_power;
+    extra.digest_power *= linkedlist<A, Allocator>::digest_base;
+}
 
-    A value = temp->value;
-    delete temp;
-    
-    temp = nullptr;
-    (*this->length)--;
-    return value;
+/**
+ * @brief Accounts for the last value popped from the list in the cached hash.
+ * @param value The popped value.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::digest_pop_back(const A &value)
+{
+    if (!this->tracks_hash() || this->state->extra == nullptr || !this->state->extra->digest_valid)
+    {
+        this->digest_invalidate();
+        return;
+    }
+
+    typename linkedlist<A, Allocator>::extension &extra = *this->state->extra;
+    extra.digest = (extra.digest - linkedlist<A, Allocator>::digest_term(value)) * linkedlist<A, Allocator>::digest_inverse;
+    extra.digest_power *= linkedlist<A, Allocator>::digest_inverse;
 }
 
 /**
- * @brief Pops and returns the last value from the singly linked list.
- *
- * This method removes and returns the last node from the list.
- *
- * @return The value of the last node.
+ * @brief Accounts for the first value popped from the list in the cached hash.
+ * @param value The popped value.
  */
-template <typename A>
-A singly_linked_list<A>::pop()
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::digest_pop_front(const A &value)
 {
-    return this->pop(-1L);
+    if (!this->tracks_hash() || this->state->extra == nullptr || !this->state->extra->digest_valid)
+    {
+        this->digest_invalidate();
+        return;
+    }
+
+    typename linkedlist<A, Allocator>::extension &extra = *this->state->extra;
+    extra.digest_power *= linkedlist<A, Allocator>::digest_inverse;
+    extra.digest -= linkedlist<A, Allocator>::digest_term(value) * extra.digest_power;
 }
 
 /**
- * @brief Returns the number of elements in the singly linked list.
- *
- * @return The number of elements in the list.
+ * @brief Marks the cached hash stale after a mutation it cannot follow.
  */
-template <typename A>
-constexpr size_t singly_linked_list<A>::size() const
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::digest_invalidate()
 {
-    return *this->length;
+    if (this->state->extra != nullptr)
+        this->state->extra->digest_valid = false;
 }
 
 /**
- * @brief Checks if the linked list contains a specific value.
- *
- * @param value The value to search for in the linked list.
- * @return true if the value is found, false` otherwise.
+ * @brief Keeps the known order of the list up to date for a value about to be appended, if the order is tracked.
+ * @param value The value to append.
  */
-template <typename A>
-bool singly_linked_list<A>::contains(const A &value) const
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::order_append(const A &value)
 {
-    typename linkedlist<A>::node *ptr = *this->head;
-    while (ptr != nullptr)
+    if (!this->tracks_order())
     {
-        if (ptr->value == value)
-            return true;
-        ptr = ptr->next;
+        this->order_invalidate();
+        return;
     }
-    
-    return false;
+
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
+    if (this->isempty())
+    {
+        extra.ascending = extra.descending = true;
+        return;
+    }
+
+    if (extra.ascending && !(this->state->tail->value <= value))
+        extra.ascending = false;
+    if (extra.descending && !(this->state->tail->value >= value))
+        extra.descending = false;
 }
 
 /**
- * @brief Finds the index of the first occurrence of a specific value in the singly linked list.
- *
- * This method returns the index of the first node containing the specified value. If the value is not found, it returns the size of the list.
- *
- * @param value The value to search for.
- * @return The index of the value in the list if the value is found in the list.
- * @throws VALUE_ERROR If the list is empty.
- * @throws VALUE_ERROR If the specified value is not found in the list.
+ * @brief Keeps the known order of the list up to date for a value about to be prepended, if the order is tracked.
+ * @param value The value to prepend.
  */
-template <typename A>
-int64_t singly_linked_list<A>::index(const A &value) const
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::order_prepend(const A &value)
 {
+    if (!this->tracks_order())
+    {
+        this->order_invalidate();
+        return;
+    }
+
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
     if (this->isempty())
-        throw VALUE_ERROR("Index of Element from Empty List");
+    {
+        extra.ascending = extra.descending = true;
+        return;
+    }
 
-    size_t curr_index = 0;
-    typename linkedlist<A>::node *ptr = *this->head;
-    while (ptr != nullptr)
+    if (extra.ascending && !(this->state->head->value >= value))
+        extra.ascending = false;
+    if (extra.descending && !(this->state->head->value <= value))
+        extra.descending = false;
+}
+
+/**
+ * @brief Keeps the known order of the list up to date for a value about to be linked between two nodes, if the order is tracked.
+ * @param before The node the value goes after, which must not be the tail.
+ * @param value The value to insert.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::order_insert(typename linkedlist<A, Allocator>::node *before, const A &value)
+{
+    if (!this->tracks_order())
     {
-        if (ptr->value == value)
-            return curr_index;
-        ptr = ptr->next;
-        curr_index++;
+        this->order_invalidate();
+        return;
     }
 
-    throw VALUE_ERROR("Value `x` not in List");
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
+    A &after = before->next->value;
+    if (extra.ascending && !(before->value <= value && after >= value))
+        extra.ascending = false;
+    if (extra.descending && !(before->value >= value && after <= value))
+        extra.descending = false;
 }
 
 /**
- * @brief Counts the number of occurrences of a specific value in the singly linked list.
- *
- * This method counts how many times the specified value appears in the list.
+ * @brief Records that the list was just sorted in ascending order, if the order is tracked.
  *
- * @param value The value to count.
- * @return The number of occurrences of the value.
+ * NaNs compare false both ways, so a sorted list of floating-point values is
+ * checked instead.
  */
-template <typename A>
-size_t singly_linked_list<A>::count(const A &value) const
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::order_sorted()
 {
-    size_t founds = 0;
-    if (this->isempty())
-        return founds;
+    if (!this->tracks_order())
+    {
+        this->order_invalidate();
+        return;
+    }
 
-    typename linkedlist<A>::node *ptr = *this->head;
-    while (ptr != nullptr)
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
+    if (std::is_floating_point<A>::value)
     {
-        if (ptr->value == value)
-            founds++;
-        ptr = ptr->next;
+        this->is_sorted();
+        return;
     }
 
-    return founds;
+    extra.ascending = true;
+    extra.descending = this->state->length < 2 || !(this->state->head->value < this->state->tail->value);
 }
 
 /**
- * @brief Reverses the order of nodes in the singly linked list.
+ * @brief Forgets the order of the list after a mutation it cannot follow.
+ */
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::order_invalidate()
+{
+    if (this->state->extra != nullptr)
+        this->state->extra->ascending = this->state->extra->descending = false;
+}
+
+/**
+ * @brief Checks whether a scan for a value can stop because the list is in order.
+ * @param current The value the scan is at.
+ * @param value The value searched for.
+ * @return true if `value` cannot come after `current`.
+ */
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::order_passed(A &current, const A &value) const
+{
+    const typename linkedlist<A, Allocator>::extension *extra = this->state->extra;
+
+    return extra != nullptr && ((extra->ascending && current > value) || (extra->descending && current < value));
+}
+
+/**
+ * @brief Appends a run of values, copying and linking them on several threads.
  *
- * This method reverses the linked list in place.
+ * The nodes come from one slab, allocated on the calling thread so the
+ * allocator need not be thread-safe, and each thread builds a slice of it. A
+ * list tracking its order has each thread check the order of its own slice;
+ * only the seams between slices are compared afterwards. A worker that cannot
+ * be started has its slice built on the calling thread instead.
+ *
+ * @param values The first value to append.
+ * @param count The number of values to append.
+ * @param threads The number of threads to use, or 0 for the hardware concurrency.
  */
-template <typename A> 
-void singly_linked_list<A>::reverse()
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::append_parallel(const A *values, const size_t &count, size_t threads)
 {
-    typename linkedlist<A>::node *current = *this->head, *prev = nullptr, *next_node;
-    *this->tail = *this->head;
-    while (current != nullptr)
+    typedef typename linkedlist<A, Allocator>::node node;
+    typedef typename linkedlist<A, Allocator>::slab slab;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<node> node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads > count / singly_linked_list<A, Allocator, Inline>::parallel_grain)
+        threads = count / singly_linked_list<A, Allocator, Inline>::parallel_grain;
+
+    if (threads < 2)
     {
-        next_node = current->next;
-        current->next = prev;
-        prev = current;
-        current = next_node;
+        for (size_t i = 0; i < count; i++)
+            this->append(values[i]);
+        return;
+    }
+
+    node_allocator alloc(this->alloc);
+    slab *block = this->template allocate<slab>();
+    try
+    {
+        block->nodes = node_traits::allocate(alloc, count);
+    }
+    catch (...)
+    {
+        this->deallocate(block);
+        throw;
+    }
+    block->capacity = block->live = count;
+
+    std::vector<size_t> built(threads, 0);
+    std::vector<char> ascending(threads, this->tracks_order()), descending(threads, this->tracks_order());
+    std::vector<std::exception_ptr> errors(threads);
+    auto build = [&](size_t t)
+    {
+        const size_t begin = count * t / threads, end = count * (t + 1) / threads;
+        node_allocator local(alloc);
+
+        try
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                node *ptr = block->nodes + i;
+                node_traits::construct(local, ptr);
+                built[t]++;
+                ptr->value = values[i];
+                ptr->next = ptr + 1;
+
+                if (i == begin || !(ascending[t] || descending[t]))
+                    continue;
+                if (!((ptr - 1)->value <= ptr->value))
+                    ascending[t] = false;
+                if (!((ptr - 1)->value >= ptr->value))
+                    descending[t] = false;
+            }
+        }
+        catch (...)
+        {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; t++)
+    {
+        try
+        {
+            workers.emplace_back(build, t);
+        }
+        catch (const std::system_error &)
+        {
+            build(t);
+        }
+    }
+
+    build(0);
+    for (std::thread &worker: workers)
+        worker.join();
+
+    for (size_t t = 0; t < threads; t++)
+    {
+        if (!errors[t])
+            continue;
+
+        for (size_t u = 0; u < threads; u++)
+            for (size_t i = count * u / threads; i < count * u / threads + built[u]; i++)
+                node_traits::destroy(alloc, block->nodes + i);
+        node_traits::deallocate(alloc, block->nodes, count);
+        this->deallocate(block);
+        std::rethrow_exception(errors[t]);
+    }
+
+    block->nodes[count - 1].next = nullptr;
+    typename linkedlist<A, Allocator>::extension &extra = this->extras();
+    block->next = extra.slabs;
+    extra.slabs = block;
+    LINKEDLIST_STAT_ALLOCS(count);
+
+    node *last = this->state->tail;
+    bool ascends = last == nullptr || extra.ascending, descends = last == nullptr || extra.descending;
+    if (this->isempty())
+        this->state->head = block->nodes;
+    else
+        (this->state->tail)->next = block->nodes;
+
+    this->state->tail = block->nodes + count - 1;
+    this->state->length += count;
+
+    // Each slice's order is known, so only the node before it has to be compared
+    this->order_invalidate();
+    if (this->tracks_order())
+    {
+        for (size_t t = 0; t < threads && (ascends || descends); t++)
+        {
+            node *first = block->nodes + count * t / threads;
+            node *seam = (t == 0) ? last : first - 1;
+            ascends = ascends && ascending[t] && (seam == nullptr || seam->value <= first->value);
+            descends = descends && descending[t] && (seam == nullptr || seam->value >= first->value);
+        }
+        extra.ascending = ascends;
+        extra.descending = descends;
     }
 
-    *this->head = prev;
+    if (this->tracks_hash() && extra.digest_valid)
+        for (size_t i = 0; i < count; i++)
+            this->digest_append(values[i]);
+    else
+        this->digest_invalidate();
 }
 
 /**
- * @brief Sorts the singly linked list in ascending order.
+ * @brief Creates an empty node for a new value.
  *
- * This method sorts the list using merge sort.
+ * An unshared list takes the node from its inline slots while one is free, and
+ * from the allocator otherwise.
+ *
+ * @return The node, not yet linked into the list.
  */
-// MergeSort - to be implemented
-template <typename A>
-void singly_linked_list<A>::sort() 
+template <typename A, typename Allocator, size_t Inline>
+typename linkedlist<A, Allocator>::node *singly_linked_list<A, Allocator, Inline>::alloc_node()
 {
-    singly_linked_list<A> list_obj;
-    typename linkedlist<A>::node *ptr = *this->head;
-    while (ptr != nullptr)
+    typedef typename linkedlist<A, Allocator>::node node;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<node> node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    node *ptr = (Inline > 0 && this->state == &this->inline_state) ? this->claim() : nullptr;
+    if (ptr == nullptr)
+        return this->template allocate<node>();
+
+    node_allocator alloc(this->alloc);
+    try
     {
-        list_obj.insert_in_order(ptr->value);
-        ptr = ptr->next;
+        node_traits::construct(alloc, ptr);
+    }
+    catch (...)
+    {
+        this->vacate(ptr);
+        throw;
     }
 
-    this->clear();
-    this->extend(list_obj);
+    return ptr;
 }
 
 /**
- * @brief Recursively sorts the list using merge sort.
+ * @brief Moves the values `obj` kept inline into this list's slots after take().
+ *
+ * The links to them are rewritten, walking the list only as far as the last
+ * inline node; the rest of the nodes stay where they are.
  *
- * @param head The head of the list to be sorted.
- * @return The head of the sorted list.
+ * @param obj The list the nodes were taken from, whose slots are emptied.
  */
-template <typename A>
-typename linkedlist<A>::node *singly_linked_list<A>::mergesort(typename linkedlist<A>::node *head)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::relocate(singly_linked_list<A, Allocator, Inline> &obj)
 {
-    if (head == nullptr || head->next == nullptr)
-        return head;
+    typedef typename linkedlist<A, Allocator>::node node;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<node> node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
 
-    typename linkedlist<A>::node *middle = linkedlist<A>::getmiddle(head), *next_of_middle = middle->next;
-    middle->next = nullptr;
-
-    typename linkedlist<A>::node *left = singly_linked_list<A>::mergesort(head);
-    typename linkedlist<A>::node *right = singly_linked_list<A>::mergesort(next_of_middle);
-
-    return singly_linked_list<A>::merge(left, right);
+    node_allocator alloc(this->alloc);
+    size_t remaining = obj.occupancy();
+    for (node **link = &this->state->head; remaining > 0; link = &(*link)->next)
+    {
+        node *ptr = *link;
+        if (!obj.holds(ptr))
+            continue;
+
+        node *moved = this->alloc_node();
+        moved->value = std::move(ptr->value);
+        moved->next = ptr->next;
+        if (this->state->tail == ptr)
+            this->state->tail = moved;
+        *link = moved;
+
+        node_traits::destroy(alloc, ptr);
+        obj.vacate(ptr);
+        remaining--;
+    }
 }
 
 /**
- * @brief Merges two sorted linked lists into one sorted list.
+ * @brief Destroys a node and returns its memory.
  *
- * @param left The head of the first sorted list.
- * @param right The head of the second sorted list.
- * @return The head of the merged sorted list.
+ * A node kept inline frees its slot. A node allocated on its own goes back to
+ * the allocator directly. A node that lives in a slab made by compact() only
+ * counts down its slab, which is freed with its last node.
+ *
+ * @param ptr The node, which must already be unlinked from the list.
  */
-template <typename A>
-typename linkedlist<A>::node *singly_linked_list<A>::merge(typename linkedlist<A>::node *left, typename linkedlist<A>::node *right)
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::free_node(typename linkedlist<A, Allocator>::node *ptr)
 {
-    if (left == nullptr)
-        return right;
-    
-    if (right == nullptr)
-        return left;
+    typedef typename linkedlist<A, Allocator>::node node;
+    typedef typename linkedlist<A, Allocator>::slab slab;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<node> node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
 
-    if (left->value <= right->value) 
+    if (this->holds(ptr))
     {
-        left->next = singly_linked_list<A>::merge(left->next, right);
-        return left;
+        node_allocator alloc(this->alloc);
+        node_traits::destroy(alloc, ptr);
+        this->vacate(ptr);
+
+        return;
     }
 
-    else
+    std::less<const node *> before;
+    for (slab **link = (this->state->extra != nullptr) ? &this->state->extra->slabs : nullptr; link != nullptr && *link != nullptr; link = &(*link)->next)
     {
-        right->next = singly_linked_list<A>::merge(left, right->next);
-        return right;
+        slab *block = *link;
+        if (before(ptr, block->nodes) || !before(ptr, block->nodes + block->capacity))
+            continue;
+
+        node_allocator alloc(this->alloc);
+        node_traits::destroy(alloc, ptr);
+
+        block->live--;
+        if (block->live == 0)
+        {
+            *link = block->next;
+            node_traits::deallocate(alloc, block->nodes, block->capacity);
+            this->deallocate(block);
+        }
+
+        return;
     }
+
+    this->deallocate(ptr);
 }
 
 /**
@@ -885,19 +3110,16 @@ typename linkedlist<A>::node *singly_linked_list<A>::merge(typename linkedlist<A
  * @param obj The linked list to be copied.
  * @return A reference to this singly linked list.
  */
-template <typename A>
-singly_linked_list<A> singly_linked_list<A>::copy() const
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::copy() const
 {
-    singly_linked_list<A> list_obj;
-    typename linkedlist<A>::node *ptr = *this->head;
+    singly_linked_list<A, Allocator, Inline> list_obj(std::allocator_traits<Allocator>::select_on_container_copy_construction(this->alloc));
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
     while (ptr != nullptr)
     {
         list_obj.append(ptr->value);
         ptr = ptr->next;
     }
-    
-    *list_obj.length = *this->length;
-    *list_obj.ref_count = 1;
 
     return list_obj;
 }
@@ -911,30 +3133,50 @@ singly_linked_list<A> singly_linked_list<A>::copy() const
  * @return A reference to the value at the specified index.
  * @throws INDEX_ERROR If the list is empty or the index is out of range.
  */
-template <typename A>
-A &singly_linked_list<A>::operator[](const int64_t &index)
+template <typename A, typename Allocator, size_t Inline>
+A &singly_linked_list<A, Allocator, Inline>::operator[](const int64_t &index)
 {
-    if (this->isempty())
-        throw INDEX_ERROR("Indexing an Empty List");
+    LINKEDLIST_TRACE(trace_op::subscript, index);
 
-    if (index < -(int64_t)(this->size()) || index >= (int64_t)(this->size()))
-        throw INDEX_ERROR("List index out of range");
+    A *value = this->try_at(index);
+    if (value != nullptr)
+        return *value;
 
-    if (index == 0L || index == -(int64_t)(this->size()))
-        return (*this->head)->value;
+    throw INDEX_ERROR(this->isempty() ? "Indexing an Empty List" : "List index out of range");
+}
 
-    int64_t curr_index = 0L;
-    if (index < 0L)
-        curr_index = -(int64_t)(this->size());
+/**
+ * @brief Accesses the value at a specific index, without throwing.
+ *
+ * Negative indices count from the end; the last value is reached in constant time.
+ *
+ * @param index The index of the value to be accessed.
+ * @return A pointer to the value, or nullptr if the index is out of range.
+ */
+template <typename A, typename Allocator, size_t Inline>
+A *singly_linked_list<A, Allocator, Inline>::try_at(const int64_t &index)
+{
+    LINKEDLIST_TRACE(trace_op::try_at, index);
+    LINKEDLIST_STAT_SCOPE(list_op::subscript);
 
-    typename linkedlist<A>::node *ptr = *this->head;
-    while (curr_index != index)
-    {
+    const int64_t length = (int64_t)this->state->length;
+    if (index < -length || index >= length)
+        return nullptr;
+
+    // The value may be written through the returned pointer
+    this->digest_invalidate();
+    this->order_invalidate();
+
+    const size_t position = (size_t)(index < 0L ? index + length : index);
+    if (position == (size_t)length - 1)
+        return &this->state->tail->value;
+
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
+    for (size_t i = 0; i < position; i++)
         ptr = ptr->next;
-        curr_index++;
-    }
+    LINKEDLIST_STAT_HOPS(position);
 
-    return ptr->value;
+    return &ptr->value;
 }
 
 /**
@@ -945,11 +3187,11 @@ A &singly_linked_list<A>::operator[](const int64_t &index)
  * @param obj The linked list to be concatenated.
  * @return A new singly linked list containing the concatenated result.
  */
-template <typename A>
-singly_linked_list<A> singly_linked_list<A>::operator+(const linkedlist<A> &obj) const
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::operator+(const linkedlist<A, Allocator> &obj) const
 {
-    singly_linked_list<A> list_obj = this->copy();
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
+    singly_linked_list<A, Allocator, Inline> list_obj = this->copy();
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr != nullptr)
     {
         list_obj.append(ptr->value);
@@ -967,11 +3209,10 @@ singly_linked_list<A> singly_linked_list<A>::operator+(const linkedlist<A> &obj)
  * @param times The number of times to repeat the list.
  * @return A new singly linked list containing the repeated list.
  */
-template <typename A>
-singly_linked_list<A> singly_linked_list<A>::operator*(const size_t &times) 
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> singly_linked_list<A, Allocator, Inline>::operator*(const size_t &times) 
 {
-    singly_linked_list<A> list_obj;
-    list_obj = this->copy();
+    singly_linked_list<A, Allocator, Inline> list_obj = this->copy();
     for (size_t i = times - 1; i != 0; i--)
         list_obj.extend(*this);
 
@@ -986,10 +3227,10 @@ singly_linked_list<A> singly_linked_list<A>::operator*(const size_t &times)
  * @param obj The linked list to compare with.
  * @return true if the current list is greater than the provided list, otherwise false.
  */
-template <typename A>
-bool singly_linked_list<A>::operator>(const linkedlist<A> &obj) const 
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::operator>(const linkedlist<A, Allocator> &obj) const 
 {
-    typename linkedlist<A>::node *ptr1 = *this->head, *ptr2 = *linkedlist<A>::gethead(obj);
+    typename linkedlist<A, Allocator>::node *ptr1 = this->state->head, *ptr2 = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr1 != nullptr && ptr2 != nullptr)
     {
         if (ptr1->value > ptr2->value)
@@ -1011,10 +3252,10 @@ bool singly_linked_list<A>::operator>(const linkedlist<A> &obj) const
  * @param obj The linked list to compare with.
  * @return true if the current list is less than the provided list, otherwise false.
  */
-template <typename A>
-bool singly_linked_list<A>::operator<(const linkedlist<A> &obj) const 
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::operator<(const linkedlist<A, Allocator> &obj) const 
 {
-    typename linkedlist<A>::node *ptr1 = *this->head, *ptr2 = *linkedlist<A>::gethead(obj);
+    typename linkedlist<A, Allocator>::node *ptr1 = this->state->head, *ptr2 = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr1 != nullptr && ptr2 != nullptr)
     {
         if (ptr1->value < ptr2->value)
@@ -1036,8 +3277,8 @@ bool singly_linked_list<A>::operator<(const linkedlist<A> &obj) const
  * @param obj The linked list to compare with.
  * @return true if the current list is greater than or equal to the provided list, otherwise false.
  */
-template <typename A>
-bool singly_linked_list<A>::operator>=(const linkedlist<A> &obj) const 
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::operator>=(const linkedlist<A, Allocator> &obj) const 
 {
     return (*this < obj);
 }
@@ -1050,10 +3291,10 @@ bool singly_linked_list<A>::operator>=(const linkedlist<A> &obj) const
  * @param obj The linked list to compare with.
  * @return true if the current list is less than or equal to the provided list, otherwise false.
  */
-template <typename A>
-bool singly_linked_list<A>::operator<=(const linkedlist<A> &obj) const 
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::operator<=(const linkedlist<A, Allocator> &obj) const 
 {
-    typename linkedlist<A>::node *ptr1 = *this->head, *ptr2 = *linkedlist<A>::gethead(obj);
+    typename linkedlist<A, Allocator>::node *ptr1 = this->state->head, *ptr2 = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr1 != nullptr && ptr2 != nullptr)
     {
         if (ptr1->value <= ptr2->value)
@@ -1071,14 +3312,25 @@ bool singly_linked_list<A>::operator<=(const linkedlist<A> &obj) const
  * @brief Checks if the current list is equal to the provided list.
  *
  * This method compares the current list with the provided list element-wise.
+ * Lists of different length are rejected at once, and so are lists that both
+ * have set_hash_tracking() enabled and whose hashes differ.
  *
  * @param obj The linked list to compare with.
  * @return true if the current list is equal to the provided list, otherwise false.
  */
-template <typename A>
-bool singly_linked_list<A>::operator==(const linkedlist<A> &obj) const 
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::operator==(const linkedlist<A, Allocator> &obj) const 
 {
-    typename linkedlist<A>::node *ptr1 = *this->head, *ptr2 = *linkedlist<A>::gethead(obj);
+    if (this->state->length != obj.size())
+        return false;
+
+    if (this->tracks_hash())
+        this->digest();
+
+    if (this->digest_differs(obj))
+        return false;
+
+    typename linkedlist<A, Allocator>::node *ptr1 = this->state->head, *ptr2 = *linkedlist<A, Allocator>::gethead(obj);
     while (ptr1 != nullptr && ptr2 != nullptr)
     {
         if (ptr1->value != ptr2->value)
@@ -1100,8 +3352,8 @@ bool singly_linked_list<A>::operator==(const linkedlist<A> &obj) const
  * @param obj The linked list to compare with.
  * @return true if the current list is not equal to the provided list, otherwise false.
  */
-template <typename A>
-bool singly_linked_list<A>::operator!=(const linkedlist<A> &obj) const
+template <typename A, typename Allocator, size_t Inline>
+bool singly_linked_list<A, Allocator, Inline>::operator!=(const linkedlist<A, Allocator> &obj) const
 {
     return !(*this == obj);
 }
@@ -1118,16 +3370,16 @@ bool singly_linked_list<A>::operator!=(const linkedlist<A> &obj) const
  *
  * @return A std::array containing the elements of the singly linked list.
  */
-template <typename A>
+template <typename A, typename Allocator, size_t Inline>
 template <size_t N>
-singly_linked_list<A>::operator std::array<A, N>()
+singly_linked_list<A, Allocator, Inline>::operator std::array<A, N>()
 {
-    if (N < *this->length)
+    if (N < this->state->length)
         throw INDEX_ERROR("Insufficient Array Capacity");
       
     size_t index = 0;
     std::array<A, N> arr;
-    typename linkedlist<A>::node *ptr = *this->head;
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
     while (ptr != nullptr)
     {
         arr[index++] = ptr->value;
@@ -1148,12 +3400,12 @@ singly_linked_list<A>::operator std::array<A, N>()
  *         the elements of the singly linked list. The caller is 
  *         responsible for deallocating the memory.
  */
-template <typename A>
-singly_linked_list<A>::operator A *()
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::operator A *()
 {
     size_t index = 0;
-    A *arr = new A[*this->length];
-    typename linkedlist<A>::node *ptr = *this->head;
+    A *arr = new A[this->state->length];
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
     while (ptr != nullptr)
     {
         arr[index++] = ptr->value;
@@ -1171,12 +3423,12 @@ singly_linked_list<A>::operator A *()
  *
  * @return A vector containing the elements of the linked list.
  */
-template <typename A>
-singly_linked_list<A>::operator std::vector<A>()
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::operator std::vector<A>()
 {
     size_t index = 0;
-    std::vector<A> vect(*this->length);
-    typename linkedlist<A>::node *ptr = *this->head;
+    std::vector<A> vect(this->state->length);
+    typename linkedlist<A, Allocator>::node *ptr = this->state->head;
     while (ptr != nullptr)
     {
         vect[index++] = ptr->value;
@@ -1193,8 +3445,8 @@ singly_linked_list<A>::operator std::vector<A>()
  *
  * @return A string representing the list's contents.
  */
-template <typename A>
-std::string singly_linked_list<A>::to_string()
+template <typename A, typename Allocator, size_t Inline>
+std::string singly_linked_list<A, Allocator, Inline>::to_string()
 {
     std::ostringstream ss;
     ss << *this;
@@ -1207,8 +3459,8 @@ std::string singly_linked_list<A>::to_string()
  *
  * This method prints the list to the standard output using the `<<` operator.
  */
-template <typename A>
-void singly_linked_list<A>::show()
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::show()
 {
     std::cout << *this;
 }
@@ -1218,18 +3470,67 @@ void singly_linked_list<A>::show()
  *
  * This method removes all elements from the list and releases allocated memory.
  */
-template <typename A>
-void singly_linked_list<A>::clear() 
+template <typename A, typename Allocator, size_t Inline>
+void singly_linked_list<A, Allocator, Inline>::clear() 
 {
-    *this->length = 0;
+    LINKEDLIST_TRACE(trace_op::clear);
+
+    this->state->length = 0;
     while (!this->isempty())
     {
-        typename linkedlist<A>::node *temp = *this->head;
-        *this->head = temp->next;
-        delete temp;
+        typename linkedlist<A, Allocator>::node *temp = this->state->head;
+        this->state->head = temp->next;
+        this->free_node(temp);
+        LINKEDLIST_STAT_FREE();
+    }
+
+    this->state->head = this->state->tail = nullptr;
+    if (this->state->extra != nullptr || this->tracks_order())
+    {
+        typename linkedlist<A, Allocator>::extension &extra = this->extras();
+        extra.digest = 0;
+        extra.digest_power = 1;
+        extra.digest_valid = true;
+        extra.ascending = extra.descending = this->tracks_order();
+    }
+}
+
+/**
+ * @brief Reports the bytes held by the list.
+ *
+ * Slots of a compact() slab whose node has been removed and empty inline slots
+ * count as reserved. A control block shared with copies of the list is counted
+ * by each of them.
+ *
+ * @return The bytes used by values, links, node padding, spare slab slots and control structures.
+ */
+template <typename A, typename Allocator, size_t Inline>
+list_memory singly_linked_list<A, Allocator, Inline>::memory_usage() const
+{
+    typedef typename linkedlist<A, Allocator>::node node;
+
+    list_memory usage = list_memory();
+    usage.payload = this->state->length * sizeof(A);
+    usage.links = this->state->length * sizeof(node *);
+    usage.padding = this->state->length * (sizeof(node) - sizeof(A) - sizeof(node *));
+    usage.control = sizeof(*this) - Inline * sizeof(node);
+    usage.reserved = (Inline - this->occupancy()) * sizeof(node);
+
+    if (this->state != &this->inline_state)
+        usage.control += sizeof(typename linkedlist<A, Allocator>::control);
+    if (this->options != nullptr)
+        usage.control += sizeof(settings);
+    if (this->state->extra == nullptr)
+        return usage;
+
+    usage.control += sizeof(typename linkedlist<A, Allocator>::extension);
+    for (const typename linkedlist<A, Allocator>::slab *block = this->state->extra->slabs; block != nullptr; block = block->next)
+    {
+        usage.reserved += (block->capacity - block->live) * sizeof(node);
+        usage.control += sizeof(typename linkedlist<A, Allocator>::slab);
     }
 
-    *this->head = *this->tail = nullptr;
+    return usage;
 }
 
 /**
@@ -1241,8 +3542,8 @@ void singly_linked_list<A>::clear()
  * @param obj The singly linked list to be repeated.
  * @return A new singly linked list containing the repeated list.
  */
-template <typename A>
-singly_linked_list<A> operator*(const size_t &times, singly_linked_list<A> &obj)
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline> operator*(const size_t &times, singly_linked_list<A, Allocator, Inline> &obj)
 {
     return obj * times;
 }
@@ -1256,8 +3557,8 @@ singly_linked_list<A> operator*(const size_t &times, singly_linked_list<A> &obj)
  * @param obj The singly linked list to be printed.
  * @return The output stream with the list data.
  */
-template <typename A>
-std::ostream &operator<<(std::ostream &out, singly_linked_list<A> &obj)
+template <typename A, typename Allocator, size_t Inline>
+std::ostream &operator<<(std::ostream &out, singly_linked_list<A, Allocator, Inline> &obj)
 {
     out << "[";
 
@@ -1267,8 +3568,8 @@ std::ostream &operator<<(std::ostream &out, singly_linked_list<A> &obj)
         return out;
     }
 
-    typename linkedlist<A>::node *ptr = *linkedlist<A>::gethead(obj);
-    while (ptr != *linkedlist<A>::gettail(obj))
+    typename linkedlist<A, Allocator>::node *ptr = *linkedlist<A, Allocator>::gethead(obj);
+    while (ptr != *linkedlist<A, Allocator>::gettail(obj))
     {
         out << ptr->value << ", ";
         ptr = ptr->next;
@@ -1282,18 +3583,12 @@ std::ostream &operator<<(std::ostream &out, singly_linked_list<A> &obj)
 /**
  * @brief Destructor for singly linked list.
  *
- * This method clears the list and releases allocated memory.
+ * Releases the nodes and bookkeeping once no other list shares them.
  */
-template <typename A>
-singly_linked_list<A>::~singly_linked_list()
+template <typename A, typename Allocator, size_t Inline>
+singly_linked_list<A, Allocator, Inline>::~singly_linked_list()
 {
-    this->clear();
-    (*this->ref_count)--;
-    if (this->ref_count == 0)
-    {
-        delete this->head;
-        delete this->tail;
-        delete this->length;
-        delete this->ref_count;
-    }
+    this->deallocate(this->options);
+    this->options = nullptr;
+    this->release();
 }
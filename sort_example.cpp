@@ -1,4 +1,5 @@
 #include <iostream>
+#include <string>
 
 #include "singly_linked_list.hpp"
 
@@ -8,7 +9,7 @@
  *
  * This program provides examples of sorting singly linked lists with various data types,
  * including integers and custom classes. It showcases the use of the sort method to 
- * perform merge sort on the list.
+ * perform merge sort on the list, with the default order, a comparator or a key.
  *
  * @author Harikrishna Srinivasan
  * @date [Current Date]
@@ -88,4 +89,17 @@ int main()
 
     my_class_list.sort();
     std::cout << "my_class_list: " << my_class_list << std::endl; // my_class_list: [1, 2, 3, 4, 5]
+
+    // Example 3: Sorting with a comparator, here in non-increasing order
+    list1.sort([](int a, int b) { return a > b; });
+    std::cout << "list1: " << list1 << std::endl; // list1: [74, 65, 58, 42, 23, 11]
+
+    // Example 4: Sorting by a key; the key function runs once per element
+    singly_linked_list<std::string> words = {"pear", "fig", "banana", "kiwi"};
+    words.sort_by_key([](const std::string &word) { return word.size(); });
+    std::cout << "words: " << words << std::endl; // words: [fig, pear, kiwi, banana]
+
+    // Inserting into a list kept in the comparator's order
+    list1.insert_in_order(50, [](int a, int b) { return a > b; });
+    std::cout << "list1: " << list1 << std::endl; // list1: [74, 65, 58, 50, 42, 23, 11]
 }
@@ -0,0 +1,173 @@
+#if __cplusplus >= 201402L
+
+#ifndef STATIC_LINKED_LIST_H
+#define STATIC_LINKED_LIST_H
+
+#include "./linkedlist.hpp"
+
+/**
+ * @brief A fixed-capacity singly linked list usable in constant expressions.
+ *
+ * Nodes live in an internal array of `N` slots and are linked by index, so the
+ * list never allocates and every operation except the conversions to
+ * `std::vector` and `std::string` is `constexpr`. Unused slots form a free list.
+ * Adding a value to a full list throws `IndexError`, which is a compile error
+ * when it happens during constant evaluation.
+ *
+ * @tparam A The value type, which must be a literal type for compile-time use.
+ * @tparam N The capacity of the list.
+ */
+template <typename A, size_t N>
+class static_linked_list final: public static_list<static_linked_list<A, N>>
+{
+    static_assert(N > 0, "static_linked_list needs a capacity of at least one");
+
+    private:
+        typedef struct slot
+        {
+            A value;
+            size_t next;
+        } slot;
+
+        static constexpr size_t nil = N;
+
+        slot nodes[N];
+        size_t head, tail, unused, length;
+
+        constexpr size_t getslot(const int64_t &index) const;
+        constexpr size_t acquire(const A &value);
+        constexpr A unlink(size_t prev, size_t index);
+
+        template <typename B, size_t M>
+        friend class static_linked_list;
+    public:
+        typedef A value_type;
+
+        class iterator
+        {
+            private:
+                slot *nodes;
+                size_t index;
+
+                constexpr iterator(slot *nodes, size_t index);
+
+                friend class static_linked_list<A, N>;
+            public:
+                constexpr iterator();
+
+                constexpr iterator &operator++();
+                constexpr iterator operator++(int);
+                constexpr A &operator*() const;
+                constexpr bool operator==(const iterator &it) const;
+                constexpr bool operator!=(const iterator &it) const;
+        };
+
+        class const_iterator
+        {
+            private:
+                const slot *nodes;
+                size_t index;
+
+                constexpr const_iterator(const slot *nodes, size_t index);
+
+                friend class static_linked_list<A, N>;
+            public:
+                constexpr const_iterator();
+
+                constexpr const_iterator &operator++();
+                constexpr const_iterator operator++(int);
+                constexpr const A &operator*() const;
+                constexpr bool operator==(const const_iterator &it) const;
+                constexpr bool operator!=(const const_iterator &it) const;
+        };
+
+        constexpr static_linked_list();
+        constexpr static_linked_list(const std::initializer_list<A> &values);
+
+        template <size_t M>
+        constexpr static_linked_list(const A (&array)[M]);
+
+        constexpr void prepend(const A &value);
+        constexpr void append(const A &value);
+        constexpr void insert(const int64_t &index, const A &value);
+        constexpr void insert_in_order(const A &value);
+
+        constexpr void extend(const std::initializer_list<A> &values);
+
+        template <size_t M>
+        constexpr void extend(const A (&array)[M]);
+
+        constexpr void remove(const A &value);
+        constexpr A pop(const int64_t &index);
+        constexpr A pop();
+
+        constexpr size_t size() const;
+        constexpr static size_t capacity();
+        constexpr bool isempty() const;
+        constexpr bool isfull() const;
+
+        constexpr bool contains(const A &value) const;
+        constexpr int64_t index(const A &value) const;
+        constexpr size_t count(const A &value) const;
+
+        constexpr void reverse();
+        constexpr void sort();
+
+        constexpr A &operator[](const int64_t &index);
+        constexpr const A &operator[](const int64_t &index) const;
+
+        template <size_t M>
+        constexpr bool operator>(const static_linked_list<A, M> &obj) const;
+        template <size_t M>
+        constexpr bool operator<(const static_linked_list<A, M> &obj) const;
+        template <size_t M>
+        constexpr bool operator>=(const static_linked_list<A, M> &obj) const;
+        template <size_t M>
+        constexpr bool operator<=(const static_linked_list<A, M> &obj) const;
+        template <size_t M>
+        constexpr bool operator==(const static_linked_list<A, M> &obj) const;
+        template <size_t M>
+        constexpr bool operator!=(const static_linked_list<A, M> &obj) const;
+
+        operator std::vector<A>() const;
+
+        std::string to_string() const;
+        void show() const;
+
+        constexpr void clear();
+
+        constexpr iterator begin();
+        constexpr iterator end();
+        constexpr const_iterator cbegin() const;
+        constexpr const_iterator cend() const;
+
+        template <typename B, size_t M>
+        friend constexpr B min(const static_linked_list<B, M> &obj);
+
+        template <typename B, size_t M>
+        friend constexpr B max(const static_linked_list<B, M> &obj);
+
+        template <typename B, size_t M>
+        friend std::ostream &operator<<(std::ostream &out, const static_linked_list<B, M> &obj);
+};
+
+template <typename A, size_t N>
+constexpr A min(const static_linked_list<A, N> &obj);
+
+template <typename A, size_t N>
+constexpr A max(const static_linked_list<A, N> &obj);
+
+template <typename A, size_t N>
+constexpr size_t len(const static_linked_list<A, N> &obj);
+
+template <typename A, size_t N>
+std::ostream &operator<<(std::ostream &out, const static_linked_list<A, N> &obj);
+
+#include "./static_linked_list.tpp"
+
+#endif
+
+#else
+    #error "Requires C++14 or later.\n"
+
+#endif
@@ -0,0 +1,932 @@
+#include "./static_linked_list.hpp"
+
+
+#if __cplusplus < 201703L
+template <typename A, size_t N>
+constexpr size_t static_linked_list<A, N>::nil;
+#endif
+
+/**
+ * @brief Default constructor for the iterator.
+ *
+ * Initializes an iterator that points past the end of no list.
+ */
+template <typename A, size_t N>
+constexpr static_linked_list<A, N>::iterator::iterator():
+    nodes(nullptr), index(N) {}
+
+/**
+ * @brief Constructor for the iterator.
+ *
+ * @param nodes The slot array of the list.
+ * @param index The slot the iterator will point to, N for the end.
+ */
+template <typename A, size_t N>
+constexpr static_linked_list<A, N>::iterator::iterator(slot *nodes, size_t index):
+    nodes(nodes), index(index) {}
+
+/**
+ * @brief Prefix increment operator for the iterator.
+ *
+ * @return A reference to the updated iterator.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::iterator &static_linked_list<A, N>::iterator::operator++()
+{
+    this->index = this->nodes[this->index].next;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the iterator.
+ *
+ * @param int Dummy parameter to distinguish from the prefix increment.
+ * @return A copy of the iterator before incrementing.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::iterator static_linked_list<A, N>::iterator::operator++(int)
+{
+    iterator it = *this;
+    this->index = this->nodes[this->index].next;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the iterator.
+ *
+ * @return A reference to the value the iterator points to.
+ */
+template <typename A, size_t N>
+constexpr A &static_linked_list<A, N>::iterator::operator*() const
+{
+    return this->nodes[this->index].value;
+}
+
+/**
+ * @brief Equality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If both iterators point to the same slot, false otherwise.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::iterator::operator==(const iterator &it) const
+{
+    return this->index == it.index;
+}
+
+/**
+ * @brief Inequality operator for the iterator.
+ *
+ * @param it The iterator to compare with.
+ * @return true If the iterators point to different slots, false otherwise.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::iterator::operator!=(const iterator &it) const
+{
+    return this->index != it.index;
+}
+
+/**
+ * @brief Default constructor for the const_iterator.
+ *
+ * Initializes a const_iterator that points past the end of no list.
+ */
+template <typename A, size_t N>
+constexpr static_linked_list<A, N>::const_iterator::const_iterator():
+    nodes(nullptr), index(N) {}
+
+/**
+ * @brief Constructor for the const_iterator.
+ *
+ * @param nodes The slot array of the list.
+ * @param index The slot the const_iterator will point to, N for the end.
+ */
+template <typename A, size_t N>
+constexpr static_linked_list<A, N>::const_iterator::const_iterator(const slot *nodes, size_t index):
+    nodes(nodes), index(index) {}
+
+/**
+ * @brief Prefix increment operator for the const_iterator.
+ *
+ * @return A reference to the updated const_iterator.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::const_iterator &static_linked_list<A, N>::const_iterator::operator++()
+{
+    this->index = this->nodes[this->index].next;
+
+    return *this;
+}
+
+/**
+ * @brief Postfix increment operator for the const_iterator.
+ *
+ * @param int Dummy parameter to distinguish from the prefix increment.
+ * @return A copy of the const_iterator before incrementing.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::const_iterator static_linked_list<A, N>::const_iterator::operator++(int)
+{
+    const_iterator it = *this;
+    this->index = this->nodes[this->index].next;
+
+    return it;
+}
+
+/**
+ * @brief Dereference operator for the const_iterator.
+ *
+ * @return A const reference to the value the const_iterator points to.
+ */
+template <typename A, size_t N>
+constexpr const A &static_linked_list<A, N>::const_iterator::operator*() const
+{
+    return this->nodes[this->index].value;
+}
+
+/**
+ * @brief Equality operator for the const_iterator.
+ *
+ * @param it The const_iterator to compare with.
+ * @return true If both const_iterators point to the same slot, false otherwise.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::const_iterator::operator==(const const_iterator &it) const
+{
+    return this->index == it.index;
+}
+
+/**
+ * @brief Inequality operator for the const_iterator.
+ *
+ * @param it The const_iterator to compare with.
+ * @return true If the const_iterators point to different slots, false otherwise.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::const_iterator::operator!=(const const_iterator &it) const
+{
+    return this->index != it.index;
+}
+
+/**
+ * @brief Default constructor for static_linked_list.
+ *
+ * Every slot starts on the free list.
+ */
+template <typename A, size_t N>
+constexpr static_linked_list<A, N>::static_linked_list():
+    nodes(), head(nil), tail(nil), unused(0), length(0)
+{
+    for (size_t i = 0; i < N; i++)
+        this->nodes[i] = slot{A(), i + 1};
+}
+
+/**
+ * @brief Constructor from an initializer list.
+ * @param values Initializer list of values to initialize the list with.
+ * @throws INDEX_ERROR If there are more than N values.
+ */
+template <typename A, size_t N>
+constexpr static_linked_list<A, N>::static_linked_list(const std::initializer_list<A> &values):
+    static_linked_list<A, N>()
+{
+    this->extend(values);
+}
+
+/**
+ * @brief Constructor from an array.
+ * @param array Array of values to initialize the list with.
+ * @throws INDEX_ERROR If the array has more than N values.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr static_linked_list<A, N>::static_linked_list(const A (&array)[M]):
+    static_linked_list<A, N>()
+{
+    this->extend(array);
+}
+
+/**
+ * @brief Returns the slot at a position of the list.
+ *
+ * @param index The position, negative positions count from the end. Must be in range.
+ * @return The index of the slot.
+ */
+template <typename A, size_t N>
+constexpr size_t static_linked_list<A, N>::getslot(const int64_t &index) const
+{
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+
+    size_t ptr = this->head;
+    for (int64_t i = 0; i < position; i++)
+        ptr = this->nodes[ptr].next;
+
+    return ptr;
+}
+
+/**
+ * @brief Takes a slot off the free list and stores a value in it.
+ *
+ * The slot is not linked into the list yet, but counts towards its length.
+ *
+ * @param value The value to store.
+ * @return The index of the slot.
+ * @throws INDEX_ERROR If all N slots are in use.
+ */
+template <typename A, size_t N>
+constexpr size_t static_linked_list<A, N>::acquire(const A &value)
+{
+    if (this->unused == nil)
+        throw INDEX_ERROR("List Capacity Exceeded");
+
+    size_t index = this->unused;
+    this->unused = this->nodes[index].next;
+
+    this->nodes[index].value = value;
+    this->nodes[index].next = nil;
+
+    this->length++;
+    return index;
+}
+
+/**
+ * @brief Unlinks a slot from the list and returns it to the free list.
+ *
+ * @param prev The slot before `index`, nil if `index` is the head.
+ * @param index The slot to unlink.
+ * @return The value that was stored in the slot.
+ */
+template <typename A, size_t N>
+constexpr A static_linked_list<A, N>::unlink(size_t prev, size_t index)
+{
+    if (prev == nil)
+        this->head = this->nodes[index].next;
+    else
+        this->nodes[prev].next = this->nodes[index].next;
+
+    if (this->tail == index)
+        this->tail = prev;
+
+    this->nodes[index].next = this->unused;
+    this->unused = index;
+
+    this->length--;
+    return this->nodes[index].value;
+}
+
+/**
+ * @brief Prepend a value to the list.
+ * @param value The value to prepend.
+ * @throws INDEX_ERROR If the list is full.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::prepend(const A &value)
+{
+    size_t index = this->acquire(value);
+    this->nodes[index].next = this->head;
+
+    if (this->tail == nil)
+        this->tail = index;
+
+    this->head = index;
+}
+
+/**
+ * @brief Append a value to the list.
+ * @param value The value to append.
+ * @throws INDEX_ERROR If the list is full.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::append(const A &value)
+{
+    size_t index = this->acquire(value);
+
+    if (this->head == nil)
+        this->head = index;
+    else
+        this->nodes[this->tail].next = index;
+
+    this->tail = index;
+}
+
+/**
+ * @brief Insert a value before a position of the list.
+ *
+ * Negative positions count from the end; positions past either end insert at that end.
+ *
+ * @param index The position to insert at.
+ * @param value The value to insert.
+ * @throws INDEX_ERROR If the list is full.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::insert(const int64_t &index, const A &value)
+{
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+
+    if (position <= 0L)
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (position >= (int64_t)this->length)
+    {
+        this->append(value);
+        return;
+    }
+
+    size_t prev = this->getslot(position - 1L);
+    size_t slot = this->acquire(value);
+
+    this->nodes[slot].next = this->nodes[prev].next;
+    this->nodes[prev].next = slot;
+}
+
+/**
+ * @brief Insert a value keeping an ascending list sorted.
+ * @param value The value to insert.
+ * @throws INDEX_ERROR If the list is full.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::insert_in_order(const A &value)
+{
+    if (this->isempty() || this->nodes[this->head].value >= value)
+    {
+        this->prepend(value);
+        return;
+    }
+
+    if (this->nodes[this->tail].value <= value)
+    {
+        this->append(value);
+        return;
+    }
+
+    size_t ptr = this->head;
+    while (this->nodes[ptr].next != nil && this->nodes[this->nodes[ptr].next].value < value)
+        ptr = this->nodes[ptr].next;
+
+    size_t slot = this->acquire(value);
+    this->nodes[slot].next = this->nodes[ptr].next;
+    this->nodes[ptr].next = slot;
+}
+
+/**
+ * @brief Extends the list with values from an initializer list.
+ * @param values The values to append.
+ * @throws INDEX_ERROR If the list becomes full.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::extend(const std::initializer_list<A> &values)
+{
+    for (const A &value: values)
+        this->append(value);
+}
+
+/**
+ * @brief Extends the list with values from an array.
+ * @param array The values to append.
+ * @throws INDEX_ERROR If the list becomes full.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr void static_linked_list<A, N>::extend(const A (&array)[M])
+{
+    for (size_t i = 0; i < M; i++)
+        this->append(array[i]);
+}
+
+/**
+ * @brief Removes the first occurrence of a value.
+ * @param value The value to remove.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::remove(const A &value)
+{
+    if (this->isempty())
+        throw VALUE_ERROR("Removing from Empty List");
+
+    size_t prev = nil, ptr = this->head;
+    while (ptr != nil && !(this->nodes[ptr].value == value))
+    {
+        prev = ptr;
+        ptr = this->nodes[ptr].next;
+    }
+
+    if (ptr == nil)
+        throw VALUE_ERROR("Removing `x`, non-element in the List");
+
+    this->unlink(prev, ptr);
+}
+
+/**
+ * @brief Removes and returns the value at a position.
+ * @param index The position, negative positions count from the end.
+ * @return The removed value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, size_t N>
+constexpr A static_linked_list<A, N>::pop(const int64_t &index)
+{
+    if (this->isempty())
+        throw INDEX_ERROR("Pop from Empty List");
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR("Pop index out of range");
+
+    int64_t position = (index < 0L) ? index + (int64_t)this->length : index;
+    if (position == 0L)
+        return this->unlink(nil, this->head);
+
+    size_t prev = this->getslot(position - 1L);
+    return this->unlink(prev, this->nodes[prev].next);
+}
+
+/**
+ * @brief Removes and returns the last value.
+ * @return The removed value.
+ * @throws INDEX_ERROR If the list is empty.
+ */
+template <typename A, size_t N>
+constexpr A static_linked_list<A, N>::pop()
+{
+    return this->pop(-1L);
+}
+
+/**
+ * @brief Returns the number of values in the list.
+ * @return The number of values.
+ */
+template <typename A, size_t N>
+constexpr size_t static_linked_list<A, N>::size() const
+{
+    return this->length;
+}
+
+/**
+ * @brief Returns the number of values the list can hold.
+ * @return N.
+ */
+template <typename A, size_t N>
+constexpr size_t static_linked_list<A, N>::capacity()
+{
+    return N;
+}
+
+/**
+ * @brief Checks if the list is empty.
+ * @return true if the list holds no values, otherwise false.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::isempty() const
+{
+    return this->head == nil;
+}
+
+/**
+ * @brief Checks if every slot of the list is in use.
+ * @return true if no more values can be added, otherwise false.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::isfull() const
+{
+    return this->unused == nil;
+}
+
+/**
+ * @brief Checks if the list contains a value.
+ * @param value The value to search for.
+ * @return true if the value is found, otherwise false.
+ */
+template <typename A, size_t N>
+constexpr bool static_linked_list<A, N>::contains(const A &value) const
+{
+    for (size_t ptr = this->head; ptr != nil; ptr = this->nodes[ptr].next)
+        if (this->nodes[ptr].value == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Returns the position of the first occurrence of a value.
+ * @param value The value to search for.
+ * @return The position of the value.
+ * @throws VALUE_ERROR If the list is empty or does not contain the value.
+ */
+template <typename A, size_t N>
+constexpr int64_t static_linked_list<A, N>::index(const A &value) const
+{
+    if (this->isempty())
+        throw VALUE_ERROR("Index of Element from Empty List");
+
+    int64_t curr_index = 0L;
+    for (size_t ptr = this->head; ptr != nil; ptr = this->nodes[ptr].next)
+    {
+        if (this->nodes[ptr].value == value)
+            return curr_index;
+        curr_index++;
+    }
+
+    throw VALUE_ERROR("Value `x` not in List");
+}
+
+/**
+ * @brief Counts the occurrences of a value.
+ * @param value The value to count.
+ * @return The number of occurrences.
+ */
+template <typename A, size_t N>
+constexpr size_t static_linked_list<A, N>::count(const A &value) const
+{
+    size_t founds = 0;
+    for (size_t ptr = this->head; ptr != nil; ptr = this->nodes[ptr].next)
+        if (this->nodes[ptr].value == value)
+            founds++;
+
+    return founds;
+}
+
+/**
+ * @brief Reverses the order of the values in place.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::reverse()
+{
+    size_t current = this->head, prev = nil;
+    this->tail = this->head;
+    while (current != nil)
+    {
+        size_t next_slot = this->nodes[current].next;
+        this->nodes[current].next = prev;
+        prev = current;
+        current = next_slot;
+    }
+
+    this->head = prev;
+}
+
+/**
+ * @brief Sorts the list in ascending order.
+ *
+ * Bottom-up merge sort on the slot links: stable, O(n log n) comparisons and no
+ * extra storage, so it also runs during constant evaluation.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::sort()
+{
+    if (this->length < 2)
+        return;
+
+    size_t sorted = this->head;
+    for (size_t width = 1; width < this->length; width *= 2)
+    {
+        size_t remaining = sorted, *link = &sorted;
+        while (remaining != nil)
+        {
+            size_t left = remaining, right = remaining;
+            for (size_t i = 1; i < width && this->nodes[right].next != nil; i++)
+                right = this->nodes[right].next;
+
+            size_t left_end = right;
+            right = this->nodes[right].next;
+            this->nodes[left_end].next = nil;
+
+            remaining = right;
+            for (size_t i = 1; i < width && remaining != nil; i++)
+                remaining = this->nodes[remaining].next;
+
+            if (remaining != nil)
+            {
+                size_t next_run = this->nodes[remaining].next;
+                this->nodes[remaining].next = nil;
+                remaining = next_run;
+            }
+
+            while (left != nil && right != nil)
+            {
+                if (this->nodes[left].value <= this->nodes[right].value)
+                {
+                    *link = left;
+                    left = this->nodes[left].next;
+                }
+
+                else
+                {
+                    *link = right;
+                    right = this->nodes[right].next;
+                }
+
+                link = &this->nodes[*link].next;
+            }
+
+            *link = (left != nil) ? left : right;
+            while (*link != nil)
+            {
+                this->tail = *link;
+                link = &this->nodes[*link].next;
+            }
+        }
+    }
+
+    this->head = sorted;
+}
+
+/**
+ * @brief Accesses the value at a position.
+ * @param index The position, negative positions count from the end.
+ * @return A reference to the value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, size_t N>
+constexpr A &static_linked_list<A, N>::operator[](const int64_t &index)
+{
+    if (this->isempty())
+        throw INDEX_ERROR("Indexing an Empty List");
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR("List index out of range");
+
+    return this->nodes[this->getslot(index)].value;
+}
+
+/**
+ * @brief Accesses the value at a position of a const list.
+ * @param index The position, negative positions count from the end.
+ * @return A const reference to the value.
+ * @throws INDEX_ERROR If the list is empty or the index is out of range.
+ */
+template <typename A, size_t N>
+constexpr const A &static_linked_list<A, N>::operator[](const int64_t &index) const
+{
+    if (this->isempty())
+        throw INDEX_ERROR("Indexing an Empty List");
+
+    if (index < -(int64_t)(this->length) || index >= (int64_t)(this->length))
+        throw INDEX_ERROR("List index out of range");
+
+    return this->nodes[this->getslot(index)].value;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater, otherwise false.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr bool static_linked_list<A, N>::operator>(const static_linked_list<A, M> &obj) const
+{
+    return obj < *this;
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than another.
+ * @param obj The list to compare with.
+ * @return true if this list is less, otherwise false.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr bool static_linked_list<A, N>::operator<(const static_linked_list<A, M> &obj) const
+{
+    size_t left = this->head, right = obj.head;
+    while (left != nil && right != static_linked_list<A, M>::nil)
+    {
+        if (this->nodes[left].value < obj.nodes[right].value)
+            return true;
+        if (obj.nodes[right].value < this->nodes[left].value)
+            return false;
+        left = this->nodes[left].next;
+        right = obj.nodes[right].next;
+    }
+
+    return left == nil && right != static_linked_list<A, M>::nil;
+}
+
+/**
+ * @brief Checks if the list is lexicographically greater than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is greater or equal, otherwise false.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr bool static_linked_list<A, N>::operator>=(const static_linked_list<A, M> &obj) const
+{
+    return !(*this < obj);
+}
+
+/**
+ * @brief Checks if the list is lexicographically less than or equal to another.
+ * @param obj The list to compare with.
+ * @return true if this list is less or equal, otherwise false.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr bool static_linked_list<A, N>::operator<=(const static_linked_list<A, M> &obj) const
+{
+    return !(obj < *this);
+}
+
+/**
+ * @brief Checks if two lists hold the same values in the same order.
+ * @param obj The list to compare with.
+ * @return true if the lists are equal, otherwise false.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr bool static_linked_list<A, N>::operator==(const static_linked_list<A, M> &obj) const
+{
+    if (this->length != obj.length)
+        return false;
+
+    size_t left = this->head, right = obj.head;
+    while (left != nil)
+    {
+        if (!(this->nodes[left].value == obj.nodes[right].value))
+            return false;
+        left = this->nodes[left].next;
+        right = obj.nodes[right].next;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Checks if two lists differ.
+ * @param obj The list to compare with.
+ * @return true if the lists are not equal, otherwise false.
+ */
+template <typename A, size_t N>
+template <size_t M>
+constexpr bool static_linked_list<A, N>::operator!=(const static_linked_list<A, M> &obj) const
+{
+    return !(*this == obj);
+}
+
+/**
+ * @brief Converts the list to a vector.
+ * @return A vector holding the values in order.
+ */
+template <typename A, size_t N>
+static_linked_list<A, N>::operator std::vector<A>() const
+{
+    std::vector<A> values;
+    values.reserve(this->length);
+    for (size_t ptr = this->head; ptr != nil; ptr = this->nodes[ptr].next)
+        values.push_back(this->nodes[ptr].value);
+
+    return values;
+}
+
+/**
+ * @brief Converts the list to a string.
+ * @return The list formatted as by `operator<<`.
+ */
+template <typename A, size_t N>
+std::string static_linked_list<A, N>::to_string() const
+{
+    std::ostringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+/**
+ * @brief Prints the list to the standard output.
+ */
+template <typename A, size_t N>
+void static_linked_list<A, N>::show() const
+{
+    std::cout << *this;
+}
+
+/**
+ * @brief Removes every value, returning all slots to the free list.
+ */
+template <typename A, size_t N>
+constexpr void static_linked_list<A, N>::clear()
+{
+    for (size_t i = 0; i < N; i++)
+        this->nodes[i].next = i + 1;
+
+    this->head = this->tail = nil;
+    this->unused = 0;
+    this->length = 0;
+}
+
+/**
+ * @brief Get an iterator to the first value.
+ * @return An iterator to the head of the list.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::iterator static_linked_list<A, N>::begin()
+{
+    return iterator(this->nodes, this->head);
+}
+
+/**
+ * @brief Get an iterator past the last value.
+ * @return An iterator to the end of the list.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::iterator static_linked_list<A, N>::end()
+{
+    return iterator(this->nodes, nil);
+}
+
+/**
+ * @brief Get a const_iterator to the first value.
+ * @return A const_iterator to the head of the list.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::const_iterator static_linked_list<A, N>::cbegin() const
+{
+    return const_iterator(this->nodes, this->head);
+}
+
+/**
+ * @brief Get a const_iterator past the last value.
+ * @return A const_iterator to the end of the list.
+ */
+template <typename A, size_t N>
+constexpr typename static_linked_list<A, N>::const_iterator static_linked_list<A, N>::cend() const
+{
+    return const_iterator(this->nodes, nil);
+}
+
+/**
+ * @brief Finds the minimum value of a static linked list.
+ * @param obj The list to search.
+ * @return The minimum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A, size_t N>
+constexpr A min(const static_linked_list<A, N> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding min in Empty List");
+
+    A min_value = obj.nodes[obj.head].value;
+    for (size_t ptr = obj.nodes[obj.head].next; ptr != N; ptr = obj.nodes[ptr].next)
+        if (obj.nodes[ptr].value < min_value)
+            min_value = obj.nodes[ptr].value;
+
+    return min_value;
+}
+
+/**
+ * @brief Finds the maximum value of a static linked list.
+ * @param obj The list to search.
+ * @return The maximum value.
+ * @throws VALUE_ERROR If the list is empty.
+ */
+template <typename A, size_t N>
+constexpr A max(const static_linked_list<A, N> &obj)
+{
+    if (obj.isempty())
+        throw VALUE_ERROR("Finding max in Empty List");
+
+    A max_value = obj.nodes[obj.head].value;
+    for (size_t ptr = obj.nodes[obj.head].next; ptr != N; ptr = obj.nodes[ptr].next)
+        if (obj.nodes[ptr].value > max_value)
+            max_value = obj.nodes[ptr].value;
+
+    return max_value;
+}
+
+/**
+ * @brief Returns the number of values in a static linked list.
+ * @param obj The list.
+ * @return The number of values.
+ */
+template <typename A, size_t N>
+constexpr size_t len(const static_linked_list<A, N> &obj)
+{
+    return obj.size();
+}
+
+/**
+ * @brief Outputs the static linked list to an output stream.
+ * @param out The output stream to which the list will be written.
+ * @param obj The list to be printed.
+ * @return The output stream with the list data.
+ */
+template <typename A, size_t N>
+std::ostream &operator<<(std::ostream &out, const static_linked_list<A, N> &obj)
+{
+    out << "[";
+
+    for (size_t ptr = obj.head; ptr != N; ptr = obj.nodes[ptr].next)
+    {
+        out << obj.nodes[ptr].value;
+        if (obj.nodes[ptr].next != N)
+            out << ", ";
+    }
+
+    out << "]";
+
+    return out;
+}
@@ -0,0 +1,57 @@
+#include <iostream>
+
+#include "static_linked_list.hpp"
+
+/**
+ * @file static_linked_list_example.cpp
+ * @brief Demonstrates the usage of a fixed-capacity static linked list.
+ *
+ * This program builds a sorted lookup table at compile time, checks it with
+ * `static_assert`, and then uses the same list type at run time.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+constexpr static_linked_list<int, 8> make_primes()
+{
+    static_linked_list<int, 8> primes = {7, 2, 13, 5};
+    primes.insert_in_order(17); // kept at the end: the list is not sorted yet
+    primes.sort();
+    primes.insert_in_order(3);
+    primes.insert_in_order(11);
+
+    return primes;
+}
+
+// Built entirely by the compiler, no allocation at run time
+constexpr static_linked_list<int, 8> primes = make_primes();
+
+static_assert(primes.size() == 7, "seven primes");
+static_assert(primes[0] == 2 && primes[-1] == 17, "sorted ascending");
+static_assert(primes.contains(11) && !primes.contains(9), "membership");
+
+int main()
+{
+    std::cout << "primes: " << primes << std::endl; // primes: [2, 3, 5, 7, 11, 13, 17]
+    std::cout << "capacity: " << primes.capacity() << std::endl; // capacity: 8
+
+    // Copies are plain values and can be modified at run time
+    static_linked_list<int, 8> odd = primes;
+    odd.remove(2);
+    odd.append(19);
+    std::cout << "odd primes: " << odd << std::endl; // odd primes: [3, 5, 7, 11, 13, 17, 19]
+    std::cout << "full: " << std::boolalpha << odd.isfull() << std::endl; // full: false
+
+    try
+    {
+        odd.extend({23, 29});
+    }
+    catch (const IndexError &e)
+    {
+        std::cout << "error: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#ifndef STATIC_LIST_H
+#define STATIC_LIST_H
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L && defined(__has_include)
+    #if __has_include(<concepts>)
+        #include <concepts>
+        #define LINKEDLIST_CONCEPTS
+    #endif
+#endif
+
+/**
+ * @brief Static (CRTP) interface shared by the concrete list classes.
+ *
+ * `linkedlist` dispatches every operation through the vtable, which keeps it
+ * usable as a type-erased base but stops the compiler from inlining calls made
+ * through a `linkedlist` reference. The concrete lists are `final` and also derive
+ * from `static_list<Derived>`; the algorithms below resolve `append`, `contains`
+ * and iteration on `Derived` at compile time, so they inline fully.
+ *
+ * @tparam Derived The concrete list type, e.g. `singly_linked_list<A>`.
+ */
+template <typename Derived>
+class static_list
+{
+    protected:
+        static_list() = default;
+
+        Derived &derived();
+        const Derived &derived() const;
+    public:
+        template <typename Iterator>
+        void append_range(Iterator first, Iterator last);
+
+        template <typename Iterator>
+        bool contains_all(Iterator first, Iterator last) const;
+
+        template <typename Predicate>
+        size_t count_if(Predicate pred) const;
+
+        template <typename Predicate>
+        bool any_of(Predicate pred) const;
+
+        template <typename Predicate>
+        bool all_of(Predicate pred) const;
+
+        template <typename Function>
+        void for_each(Function func);
+
+        ~static_list() = default;
+};
+
+#ifdef LINKEDLIST_CONCEPTS
+
+/**
+ * @brief A list type whose operations can be called without virtual dispatch.
+ *
+ * Generic code constrained on `list_type` accepts `singly_linked_list`,
+ * `doubly_linked_list` or any other `static_list` with the same core operations.
+ */
+template <typename L>
+concept list_type = std::derived_from<L, static_list<L>> &&
+    requires(L &list, const L &view, const typename L::value_type &value, const int64_t &index)
+    {
+        list.append(value);
+        list.prepend(value);
+        list.pop();
+        list[index];
+        { view.contains(value) } -> std::convertible_to<bool>;
+        { view.size() } -> std::convertible_to<size_t>;
+        { view.isempty() } -> std::convertible_to<bool>;
+    };
+
+    #define LIST_TYPE list_type
+#else
+    #define LIST_TYPE typename
+#endif
+
+#include "./static_list.tpp"
+
+#endif
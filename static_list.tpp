@@ -0,0 +1,127 @@
+#include "./static_list.hpp"
+
+
+/**
+ * @brief Returns this object as the concrete list type.
+ *
+ * @return A reference to the derived list.
+ */
+template <typename Derived>
+Derived &static_list<Derived>::derived()
+{
+    return static_cast<Derived &>(*this);
+}
+
+/**
+ * @brief Returns this object as the concrete list type.
+ *
+ * @return A const reference to the derived list.
+ */
+template <typename Derived>
+const Derived &static_list<Derived>::derived() const
+{
+    return static_cast<const Derived &>(*this);
+}
+
+/**
+ * @brief Appends every value of a range to the list.
+ *
+ * @tparam Iterator An input iterator over values convertible to the list's value type.
+ * @param first The beginning of the range.
+ * @param last The end of the range.
+ */
+template <typename Derived>
+template <typename Iterator>
+void static_list<Derived>::append_range(Iterator first, Iterator last)
+{
+    for (; first != last; ++first)
+        this->derived().append(*first);
+}
+
+/**
+ * @brief Checks if the list contains every value of a range.
+ *
+ * @tparam Iterator An input iterator over values convertible to the list's value type.
+ * @param first The beginning of the range.
+ * @param last The end of the range.
+ * @return true if every value is found in the list, otherwise false.
+ */
+template <typename Derived>
+template <typename Iterator>
+bool static_list<Derived>::contains_all(Iterator first, Iterator last) const
+{
+    for (; first != last; ++first)
+        if (!this->derived().contains(*first))
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief Counts the values that satisfy a predicate.
+ *
+ * @tparam Predicate A callable taking a const value reference and returning bool.
+ * @param pred The predicate.
+ * @return The number of values for which `pred` returns true.
+ */
+template <typename Derived>
+template <typename Predicate>
+size_t static_list<Derived>::count_if(Predicate pred) const
+{
+    size_t count = 0;
+    for (auto it = this->derived().cbegin(); it != this->derived().cend(); ++it)
+        if (pred(*it))
+            count++;
+
+    return count;
+}
+
+/**
+ * @brief Checks if any value satisfies a predicate.
+ *
+ * @tparam Predicate A callable taking a const value reference and returning bool.
+ * @param pred The predicate.
+ * @return true if `pred` returns true for at least one value, otherwise false.
+ */
+template <typename Derived>
+template <typename Predicate>
+bool static_list<Derived>::any_of(Predicate pred) const
+{
+    for (auto it = this->derived().cbegin(); it != this->derived().cend(); ++it)
+        if (pred(*it))
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief Checks if every value satisfies a predicate.
+ *
+ * @tparam Predicate A callable taking a const value reference and returning bool.
+ * @param pred The predicate.
+ * @return true if `pred` returns true for every value or the list is empty, otherwise false.
+ */
+template <typename Derived>
+template <typename Predicate>
+bool static_list<Derived>::all_of(Predicate pred) const
+{
+    for (auto it = this->derived().cbegin(); it != this->derived().cend(); ++it)
+        if (!pred(*it))
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief Calls a function on every value, front to back.
+ *
+ * @tparam Function A callable taking a value reference, which it may modify.
+ * @param func The function to be called.
+ */
+template <typename Derived>
+template <typename Function>
+void static_list<Derived>::for_each(Function func)
+{
+    for (auto it = this->derived().begin(); it != this->derived().end(); ++it)
+        func(*it);
+}
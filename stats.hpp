@@ -0,0 +1,129 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <iostream>
+
+#ifdef LINKEDLIST_STATS
+    #include <atomic>
+    #include <chrono>
+#endif
+
+/**
+ * @brief Operations whose node hops are counted individually.
+ */
+enum class list_op
+{
+    subscript,
+    insert,
+    insert_in_order,
+    pop,
+    remove,
+    contains,
+    index,
+    count,
+    len
+};
+
+#define LIST_OPS 9
+#define LIST_LATENCY_BUCKETS 40
+
+/**
+ * @brief A snapshot of the list instrumentation counters.
+ *
+ * Counters are process-wide and only advance when the library is compiled with
+ * `LINKEDLIST_STATS` defined; the per-operation latency histogram additionally
+ * needs `LINKEDLIST_STATS_LATENCY`. Latency bucket `b` counts calls that took
+ * between 2^b and 2^(b+1) nanoseconds.
+ */
+struct list_stats
+{
+    size_t allocations;  ///< Nodes allocated
+    size_t frees;        ///< Nodes freed
+    size_t comparisons;  ///< Ordering comparisons made by sort and insert_in_order
+    size_t exceptions;   ///< Exceptions constructed by the library
+    size_t calls[LIST_OPS];  ///< Calls per list_op
+    size_t hops[LIST_OPS];   ///< Node hops per list_op
+    size_t latency[LIST_OPS][LIST_LATENCY_BUCKETS];  ///< Latency histogram per list_op
+
+#ifdef LINKEDLIST_STATS
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+#if defined(LINKEDLIST_STATS) && defined(LINKEDLIST_STATS_LATENCY)
+    static constexpr bool latency_enabled = true;
+#else
+    static constexpr bool latency_enabled = false;
+#endif
+
+    static const char *name(list_op op);
+};
+
+list_stats stats();
+void reset_stats();
+
+std::ostream &operator<<(std::ostream &out, const list_stats &snapshot);
+
+#ifdef LINKEDLIST_STATS
+
+/**
+ * @brief Live counters behind stats().
+ */
+class list_stats_registry
+{
+    public:
+        std::atomic<size_t> allocations, frees, comparisons, exceptions;
+        std::atomic<size_t> calls[LIST_OPS], hops[LIST_OPS];
+        std::atomic<size_t> latency[LIST_OPS][LIST_LATENCY_BUCKETS];
+
+        static list_stats_registry &instance();
+};
+
+/**
+ * @brief Records the hops, and optionally the latency, of one operation call.
+ *
+ * Hops are charged to the innermost scope open on the calling thread, so helpers
+ * that walk the list on behalf of an operation are attributed to it. The record
+ * is made on destruction, so calls that throw are counted too.
+ */
+class list_stats_scope
+{
+    private:
+        list_op op;
+        list_stats_scope *outer;
+#ifdef LINKEDLIST_STATS_LATENCY
+        std::chrono::steady_clock::time_point start;
+#endif
+    public:
+        size_t hops;
+
+        list_stats_scope(list_op op);
+        ~list_stats_scope();
+
+        static list_stats_scope *&current();
+        static void hop(size_t n);
+};
+
+    #define LINKEDLIST_STAT_SCOPE(op) list_stats_scope linkedlist_stat_scope(op)
+    #define LINKEDLIST_STAT_HOP() list_stats_scope::hop(1)
+    #define LINKEDLIST_STAT_HOPS(n) list_stats_scope::hop(n)
+    #define LINKEDLIST_STAT_ALLOC() (list_stats_registry::instance().allocations.fetch_add(1, std::memory_order_relaxed))
+    #define LINKEDLIST_STAT_ALLOCS(n) (list_stats_registry::instance().allocations.fetch_add(n, std::memory_order_relaxed))
+    #define LINKEDLIST_STAT_FREE() (list_stats_registry::instance().frees.fetch_add(1, std::memory_order_relaxed))
+    #define LINKEDLIST_STAT_COMPARE() (list_stats_registry::instance().comparisons.fetch_add(1, std::memory_order_relaxed))
+    #define LINKEDLIST_STAT_EXCEPTION() (list_stats_registry::instance().exceptions.fetch_add(1, std::memory_order_relaxed))
+#else
+    #define LINKEDLIST_STAT_SCOPE(op)
+    #define LINKEDLIST_STAT_HOP() ((void)0)
+    #define LINKEDLIST_STAT_HOPS(n) ((void)0)
+    #define LINKEDLIST_STAT_ALLOC() ((void)0)
+    #define LINKEDLIST_STAT_ALLOCS(n) ((void)0)
+    #define LINKEDLIST_STAT_FREE() ((void)0)
+    #define LINKEDLIST_STAT_COMPARE() ((void)0)
+    #define LINKEDLIST_STAT_EXCEPTION() ((void)0)
+#endif
+
+#include "./stats.tpp"
+
+#endif
@@ -0,0 +1,184 @@
+#include "./stats.hpp"
+
+
+/**
+ * @brief Returns the printable name of an operation.
+ *
+ * @param op The operation.
+ * @return The name of the list method the operation stands for.
+ */
+inline const char *list_stats::name(list_op op)
+{
+    static const char *const names[LIST_OPS] = {
+        "operator[]", "insert", "insert_in_order", "pop", "remove", "contains", "index", "count", "len"
+    };
+
+    return names[(int)op];
+}
+
+#ifdef LINKEDLIST_STATS
+
+/**
+ * @brief Returns the process-wide counter registry.
+ *
+ * @return The registry, zero-initialised on first use.
+ */
+inline list_stats_registry &list_stats_registry::instance()
+{
+    static list_stats_registry registry;
+
+    return registry;
+}
+
+/**
+ * @brief Starts recording one call of an operation.
+ *
+ * @param op The operation being called.
+ */
+inline list_stats_scope::list_stats_scope(list_op op):
+    op(op), outer(list_stats_scope::current()),
+#ifdef LINKEDLIST_STATS_LATENCY
+    start(std::chrono::steady_clock::now()),
+#endif
+    hops(0)
+{
+    list_stats_scope::current() = this;
+}
+
+/**
+ * @brief Adds the call, its hops and its latency to the registry.
+ */
+inline list_stats_scope::~list_stats_scope()
+{
+    list_stats_scope::current() = this->outer;
+
+    list_stats_registry &registry = list_stats_registry::instance();
+    registry.calls[(int)this->op].fetch_add(1, std::memory_order_relaxed);
+    registry.hops[(int)this->op].fetch_add(this->hops, std::memory_order_relaxed);
+
+#ifdef LINKEDLIST_STATS_LATENCY
+    long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - this->start).count();
+
+    int bucket = 0;
+    while (elapsed > 1 && bucket < LIST_LATENCY_BUCKETS - 1)
+    {
+        elapsed >>= 1;
+        bucket++;
+    }
+
+    registry.latency[(int)this->op][bucket].fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+/**
+ * @brief Returns the innermost open scope of the calling thread.
+ *
+ * @return A reference to the thread's current scope pointer, nullptr outside any operation.
+ */
+inline list_stats_scope *&list_stats_scope::current()
+{
+    thread_local list_stats_scope *scope = nullptr;
+
+    return scope;
+}
+
+/**
+ * @brief Charges node hops to the innermost open scope.
+ *
+ * @param n The number of `next` or `prev` links followed.
+ */
+inline void list_stats_scope::hop(size_t n)
+{
+    list_stats_scope *scope = list_stats_scope::current();
+    if (scope != nullptr)
+        scope->hops += n;
+}
+
+#endif
+
+/**
+ * @brief Takes a snapshot of the instrumentation counters.
+ *
+ * All counters are zero unless the library is compiled with `LINKEDLIST_STATS`.
+ *
+ * @return A copy of the counters at the time of the call.
+ */
+inline list_stats stats()
+{
+    list_stats snapshot = list_stats();
+
+#ifdef LINKEDLIST_STATS
+    list_stats_registry &registry = list_stats_registry::instance();
+    snapshot.allocations = registry.allocations.load(std::memory_order_relaxed);
+    snapshot.frees = registry.frees.load(std::memory_order_relaxed);
+    snapshot.comparisons = registry.comparisons.load(std::memory_order_relaxed);
+    snapshot.exceptions = registry.exceptions.load(std::memory_order_relaxed);
+
+    for (int op = 0; op < LIST_OPS; op++)
+    {
+        snapshot.calls[op] = registry.calls[op].load(std::memory_order_relaxed);
+        snapshot.hops[op] = registry.hops[op].load(std::memory_order_relaxed);
+        for (int bucket = 0; bucket < LIST_LATENCY_BUCKETS; bucket++)
+            snapshot.latency[op][bucket] = registry.latency[op][bucket].load(std::memory_order_relaxed);
+    }
+#endif
+
+    return snapshot;
+}
+
+/**
+ * @brief Resets every instrumentation counter to zero.
+ */
+inline void reset_stats()
+{
+#ifdef LINKEDLIST_STATS
+    list_stats_registry &registry = list_stats_registry::instance();
+    registry.allocations = 0;
+    registry.frees = 0;
+    registry.comparisons = 0;
+    registry.exceptions = 0;
+
+    for (int op = 0; op < LIST_OPS; op++)
+    {
+        registry.calls[op] = 0;
+        registry.hops[op] = 0;
+        for (int bucket = 0; bucket < LIST_LATENCY_BUCKETS; bucket++)
+            registry.latency[op][bucket] = 0;
+    }
+#endif
+}
+
+/**
+ * @brief Writes a human readable summary of a stats snapshot.
+ *
+ * Operations that were never called are omitted.
+ *
+ * @param out The output stream to write to.
+ * @param snapshot The snapshot to be printed.
+ * @return The output stream.
+ */
+inline std::ostream &operator<<(std::ostream &out, const list_stats &snapshot)
+{
+    out << "allocations: " << snapshot.allocations << ", frees: " << snapshot.frees
+        << ", comparisons: " << snapshot.comparisons << ", exceptions: " << snapshot.exceptions << "\n";
+
+    for (int op = 0; op < LIST_OPS; op++)
+    {
+        if (snapshot.calls[op] == 0)
+            continue;
+
+        out << list_stats::name((list_op)op) << ": " << snapshot.calls[op] << " calls, "
+            << snapshot.hops[op] << " hops (" << (double)snapshot.hops[op] / (double)snapshot.calls[op] << " per call)";
+
+        if (list_stats::latency_enabled)
+        {
+            out << ", latency ns:";
+            for (int bucket = 0; bucket < LIST_LATENCY_BUCKETS; bucket++)
+                if (snapshot.latency[op][bucket] != 0)
+                    out << " <" << (1ULL << (bucket + 1)) << ":" << snapshot.latency[op][bucket];
+        }
+        out << "\n";
+    }
+
+    return out;
+}
@@ -0,0 +1,220 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "./linkedlist.hpp"
+
+/**
+ * @brief The list calls a trace records.
+ */
+enum class trace_op: uint8_t
+{
+    append,
+    prepend,
+    insert,
+    insert_in_order,
+    extend,
+    remove,
+    remove_all,
+    erase,
+    pop,
+    pop_back,
+    try_pop,
+    try_pop_back,
+    try_remove,
+    contains,
+    index,
+    count,
+    try_index,
+    subscript,
+    try_at,
+    reverse,
+    sort,
+    clear,
+    pop_front_n,
+    pop_back_n,
+    pop_range,
+    truncate,
+    insert_after,
+    erase_after
+};
+
+#define TRACE_OPS 28
+#define TRACE_VERSION 2
+
+/**
+ * @brief A run of values recorded as one field: a 64-bit count, then the values.
+ */
+template <typename Iterator>
+struct trace_range
+{
+    Iterator first, last;  ///< The values
+    size_t count;          ///< The number of values in [first, last)
+};
+
+template <typename Iterator>
+trace_range<Iterator> make_trace_range(Iterator first, Iterator last, const size_t &count);
+
+/**
+ * @brief Writes the calls made on one list to a binary trace file.
+ *
+ * The file starts with a 16-byte header: the magic `LLTRACE`, a format version,
+ * the kind and size of the value type. Each call follows as one byte of
+ * `trace_op` and its arguments in native byte order: an `int64_t` per index or
+ * position, a `uint64_t` per count, the raw bytes of each value, and for
+ * `extend` a `uint64_t` count and the values. A position stands for an iterator:
+ * the number of values up to and including it, so 0 is before_begin().
+ * Only trivially copyable value types can be recorded. The header is written
+ * when the recorder is first attached to a list, which fixes the value type.
+ *
+ * A recorder belongs to one list at a time and is not thread-safe. Writes are
+ * buffered; the file is complete once the recorder is flushed or destroyed.
+ */
+class list_trace
+{
+    private:
+        std::ofstream out;
+        std::vector<char> buffer;
+        size_t records;
+        size_t depth;
+        bool started;
+        uint8_t value_kind;
+        size_t value_bytes;
+
+        template <typename T>
+        void put(const T &field);
+        template <typename Iterator>
+        void put(const trace_range<Iterator> &range);
+
+        friend class list_trace_scope;
+        template <typename List>
+        friend class list_trace_result;
+    public:
+        template <typename A>
+        static uint8_t kind();
+
+        explicit list_trace(const std::string &path);
+        list_trace(const list_trace &obj) = delete;
+        list_trace &operator=(const list_trace &obj) = delete;
+
+        template <typename A>
+        void attach();
+
+        template <typename... Fields>
+        void record(const trace_op &op, const Fields &... fields);
+
+        size_t size() const;
+        void flush();
+
+        static const char *name(const trace_op &op);
+
+        ~list_trace();
+};
+
+/**
+ * @brief Records one call of a traced list, unless it is made by another traced call.
+ *
+ * Public methods that are implemented with other public methods would otherwise
+ * record the inner calls too, and replaying them would repeat the work.
+ */
+class list_trace_scope
+{
+    private:
+        list_trace *trace;
+    public:
+        template <typename... Fields>
+        list_trace_scope(list_trace *trace, const trace_op &op, const Fields &... fields);
+        list_trace_scope(const list_trace_scope &obj) = delete;
+        list_trace_scope &operator=(const list_trace_scope &obj) = delete;
+
+        ~list_trace_scope();
+};
+
+#define LINKEDLIST_TRACE(...) list_trace_scope linkedlist_trace_scope(this->tracer(), __VA_ARGS__)
+
+/**
+ * @brief Records the values a traced call leaves, as a `clear` and an `extend`.
+ *
+ * For calls a replay cannot repeat, such as those taking a predicate or a
+ * comparator. The values are written when the call returns or throws, unless it
+ * is made by another traced call.
+ */
+template <typename List>
+class list_trace_result
+{
+    private:
+        list_trace *trace;
+        const List &list;
+        bool outermost;
+    public:
+        list_trace_result(list_trace *trace, const List &list);
+        list_trace_result(const list_trace_result &obj) = delete;
+        list_trace_result &operator=(const list_trace_result &obj) = delete;
+
+        ~list_trace_result();
+};
+
+#define LINKEDLIST_TRACE_RESULT() list_trace_result<typename std::remove_reference<decltype(*this)>::type> linkedlist_trace_scope(this->tracer(), *this)
+
+/**
+ * @brief Reads the calls of a trace file back in order.
+ */
+class list_trace_reader
+{
+    private:
+        std::ifstream in;
+        uint8_t value_kind;
+        size_t value_bytes;
+    public:
+        explicit list_trace_reader(const std::string &path);
+
+        uint8_t kind() const;
+        size_t value_size() const;
+
+        bool next(trace_op &op);
+
+        template <typename T>
+        T get();
+};
+
+/**
+ * @brief Throughput and latency of each operation in a replayed trace.
+ *
+ * Latencies are per call, in nanoseconds, and include the clock reads.
+ */
+struct trace_report
+{
+    size_t calls[TRACE_OPS];     ///< Calls per trace_op
+    size_t failures[TRACE_OPS];  ///< Calls that threw, e.g. pop from an empty list
+    double total_ns[TRACE_OPS];  ///< Time spent in the calls
+    double p50_ns[TRACE_OPS];    ///< Median latency
+    double p90_ns[TRACE_OPS];    ///< 90th percentile latency
+    double p99_ns[TRACE_OPS];    ///< 99th percentile latency
+    double max_ns[TRACE_OPS];    ///< Slowest call
+    double wall_ns;              ///< Time for the whole replay, including reading the file
+
+    size_t total_calls() const;
+};
+
+template <typename Call>
+void replay_call(const trace_op &op, Call call, trace_report &report, std::vector<double> (&latencies)[TRACE_OPS]);
+
+template <typename List>
+typename List::iterator replay_position(List &list, const int64_t &position);
+
+template <typename List>
+trace_report replay_trace(const std::string &path, List &list);
+
+std::ostream &operator<<(std::ostream &out, const trace_report &report);
+
+#include "./trace.tpp"
+
+#endif
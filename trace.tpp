@@ -0,0 +1,638 @@
+#include "./trace.hpp"
+
+
+/**
+ * @brief Wraps a run of values as one trace field.
+ *
+ * @param first The beginning of the values.
+ * @param last The end of the values.
+ * @param count The number of values in [first, last).
+ * @return The field.
+ */
+template <typename Iterator>
+trace_range<Iterator> make_trace_range(Iterator first, Iterator last, const size_t &count)
+{
+    trace_range<Iterator> range = {first, last, count};
+
+    return range;
+}
+
+/**
+ * @brief Returns the kind of a value type, as stored in the trace header.
+ *
+ * @return 1 for signed integers, 2 for unsigned integers, 3 for floating point and 0 otherwise.
+ */
+template <typename A>
+uint8_t list_trace::kind()
+{
+    if (std::is_floating_point<A>::value)
+        return 3;
+    if (std::is_integral<A>::value)
+        return std::is_signed<A>::value ? 1 : 2;
+
+    return 0;
+}
+
+/**
+ * @brief Creates a trace file.
+ *
+ * @param path The file to create, replacing any existing one.
+ * @throws VALUE_ERROR If the file cannot be created.
+ */
+inline list_trace::list_trace(const std::string &path):
+    out(path.c_str(), std::ios::binary | std::ios::trunc), records(0), depth(0), started(false), value_kind(0), value_bytes(0)
+{
+    if (!this->out)
+        throw VALUE_ERROR("Cannot open trace file");
+
+    this->buffer.reserve(1 << 16);
+}
+
+/**
+ * @brief Prepares the recorder for a list of `A`, writing the header the first time.
+ *
+ * @throws TYPE_ERROR If the recorder was already used for another value type.
+ */
+template <typename A>
+void list_trace::attach()
+{
+    static_assert(std::is_trivially_copyable<A>::value, "Traces hold trivially copyable values only");
+
+    if (this->started)
+    {
+        if (this->value_kind != list_trace::kind<A>() || this->value_bytes != sizeof(A))
+            throw TYPE_ERROR("Trace was started with a different value type");
+        return;
+    }
+
+    this->started = true;
+    this->value_kind = list_trace::kind<A>();
+    this->value_bytes = sizeof(A);
+
+    const char magic[7] = {'L', 'L', 'T', 'R', 'A', 'C', 'E'};
+    for (char c: magic)
+        this->put(c);
+    this->put((uint8_t)TRACE_VERSION);
+    this->put(this->value_kind);
+    this->put((uint8_t)0);
+    this->put((uint16_t)0);
+    this->put((uint32_t)this->value_bytes);
+}
+
+/**
+ * @brief Appends the raw bytes of one field to the buffer.
+ *
+ * @param field The index or value to write.
+ */
+template <typename T>
+void list_trace::put(const T &field)
+{
+    const char *bytes = reinterpret_cast<const char *>(&field);
+    this->buffer.insert(this->buffer.end(), bytes, bytes + sizeof(T));
+
+    if (this->buffer.size() >= (1 << 16))
+        this->flush();
+}
+
+/**
+ * @brief Appends a count and a run of values to the buffer.
+ *
+ * @param range The values to write.
+ */
+template <typename Iterator>
+void list_trace::put(const trace_range<Iterator> &range)
+{
+    this->put((uint64_t)range.count);
+    for (Iterator it = range.first; it != range.last; ++it)
+        this->put(*it);
+}
+
+/**
+ * @brief Writes one call and its arguments.
+ *
+ * @param op The call.
+ * @param fields Its arguments, in the order of the method's parameters.
+ */
+template <typename... Fields>
+void list_trace::record(const trace_op &op, const Fields &... fields)
+{
+    this->put((uint8_t)op);
+
+    int expand[] = {0, (this->put(fields), 0)...};
+    (void)expand;
+
+    this->records++;
+}
+
+/**
+ * @brief Returns the number of calls recorded so far.
+ *
+ * @return The number of calls.
+ */
+inline size_t list_trace::size() const
+{
+    return this->records;
+}
+
+/**
+ * @brief Writes the buffered calls to the file.
+ */
+inline void list_trace::flush()
+{
+    this->out.write(this->buffer.data(), (std::streamsize)this->buffer.size());
+    this->out.flush();
+    this->buffer.clear();
+}
+
+/**
+ * @brief Returns the printable name of a traced call.
+ *
+ * @param op The call.
+ * @return The name of the list method the call stands for.
+ */
+inline const char *list_trace::name(const trace_op &op)
+{
+    static const char *const names[TRACE_OPS] = {
+        "append", "prepend", "insert", "insert_in_order", "extend", "remove", "remove_all", "erase",
+        "pop", "pop()", "try_pop", "try_pop()", "try_remove", "contains", "index", "count", "try_index",
+        "operator[]", "try_at", "reverse", "sort", "clear", "pop_front_n", "pop_back_n", "pop_range", "truncate",
+        "insert_after", "erase_after"
+    };
+
+    return names[(int)op];
+}
+
+/**
+ * @brief Flushes the remaining calls and closes the file.
+ */
+inline list_trace::~list_trace()
+{
+    this->flush();
+}
+
+/**
+ * @brief Records a call if a recorder is attached and no traced call is already running.
+ *
+ * @param trace The list's recorder, or nullptr if it is not traced.
+ * @param op The call.
+ * @param fields Its arguments.
+ */
+template <typename... Fields>
+list_trace_scope::list_trace_scope(list_trace *trace, const trace_op &op, const Fields &... fields):
+    trace(trace)
+{
+    if (this->trace == nullptr)
+        return;
+
+    if (this->trace->depth == 0)
+        this->trace->record(op, fields...);
+    this->trace->depth++;
+}
+
+/**
+ * @brief Ends the call, letting the next one be recorded.
+ */
+inline list_trace_scope::~list_trace_scope()
+{
+    if (this->trace != nullptr)
+        this->trace->depth--;
+}
+
+/**
+ * @brief Starts a call whose result is recorded instead of its arguments.
+ *
+ * @param trace The list's recorder, or nullptr if it is not traced.
+ * @param list The list the call is made on.
+ */
+template <typename List>
+list_trace_result<List>::list_trace_result(list_trace *trace, const List &list):
+    trace(trace), list(list), outermost(trace != nullptr && trace->depth == 0)
+{
+    if (this->trace != nullptr)
+        this->trace->depth++;
+}
+
+/**
+ * @brief Ends the call and records the values it left.
+ */
+template <typename List>
+list_trace_result<List>::~list_trace_result()
+{
+    if (this->trace == nullptr)
+        return;
+
+    this->trace->depth--;
+    if (!this->outermost)
+        return;
+
+    this->trace->record(trace_op::clear);
+    if (this->list.size() != 0)
+        this->trace->record(trace_op::extend, make_trace_range(this->list.cbegin(), this->list.cend(), this->list.size()));
+}
+
+/**
+ * @brief Opens a trace file and reads its header.
+ *
+ * @param path The trace file.
+ * @throws VALUE_ERROR If the file cannot be opened or is not a trace of this or an earlier version.
+ */
+inline list_trace_reader::list_trace_reader(const std::string &path):
+    in(path.c_str(), std::ios::binary)
+{
+    if (!this->in)
+        throw VALUE_ERROR("Cannot open trace file");
+
+    char magic[7];
+    if (!this->in.read(magic, sizeof(magic)) || std::memcmp(magic, "LLTRACE", sizeof(magic)) != 0)
+        throw VALUE_ERROR("Not a list trace file");
+
+    const uint8_t version = this->get<uint8_t>();
+    if (version == 0 || version > TRACE_VERSION)
+        throw VALUE_ERROR("Unsupported trace file version");
+
+    this->value_kind = this->get<uint8_t>();
+    this->get<uint8_t>();
+    this->get<uint16_t>();
+    this->value_bytes = this->get<uint32_t>();
+}
+
+/**
+ * @brief Returns the kind of the value type the trace was recorded with.
+ *
+ * @return The kind, see list_trace::kind().
+ */
+inline uint8_t list_trace_reader::kind() const
+{
+    return this->value_kind;
+}
+
+/**
+ * @brief Returns the size of the value type the trace was recorded with.
+ *
+ * @return The size in bytes of one value.
+ */
+inline size_t list_trace_reader::value_size() const
+{
+    return this->value_bytes;
+}
+
+/**
+ * @brief Reads the next call.
+ *
+ * @param op Set to the call.
+ * @return true if a call was read, false at the end of the trace.
+ * @throws VALUE_ERROR If the call is not a known trace_op.
+ */
+inline bool list_trace_reader::next(trace_op &op)
+{
+    uint8_t code;
+    if (!this->in.read(reinterpret_cast<char *>(&code), 1))
+        return false;
+
+    if (code >= TRACE_OPS)
+        throw VALUE_ERROR("Corrupt trace file");
+
+    op = (trace_op)code;
+    return true;
+}
+
+/**
+ * @brief Reads one argument of the current call.
+ *
+ * @return The index or value.
+ * @throws VALUE_ERROR If the trace ends in the middle of the call.
+ */
+template <typename T>
+T list_trace_reader::get()
+{
+    T field;
+    if (!this->in.read(reinterpret_cast<char *>(&field), sizeof(T)))
+        throw VALUE_ERROR("Truncated trace file");
+
+    return field;
+}
+
+/**
+ * @brief Returns the number of calls in the report.
+ *
+ * @return The calls of every operation added up.
+ */
+inline size_t trace_report::total_calls() const
+{
+    size_t total = 0;
+    for (int op = 0; op < TRACE_OPS; op++)
+        total += this->calls[op];
+
+    return total;
+}
+
+/**
+ * @brief Times one replayed call and adds it to the report.
+ *
+ * A call that throws one of the library's exceptions counts as a failure; the
+ * recorded list threw the same exception, so the replay carries on.
+ *
+ * @param op The call.
+ * @param call Makes the call on the list.
+ * @param report The report to add to.
+ * @param latencies The latencies of each operation so far.
+ */
+template <typename Call>
+void replay_call(const trace_op &op, Call call, trace_report &report, std::vector<double> (&latencies)[TRACE_OPS])
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    try
+    {
+        call();
+    }
+    catch (const Exception &)
+    {
+        report.failures[(int)op]++;
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    report.calls[(int)op]++;
+    report.total_ns[(int)op] += elapsed;
+    latencies[(int)op].push_back(elapsed);
+}
+
+/**
+ * @brief Finds the iterator a recorded position stands for.
+ *
+ * @param list The list being replayed.
+ * @param position The number of values up to and including the iterator.
+ * @return The iterator, or end() if the list has fewer values than `position`.
+ */
+template <typename List>
+typename List::iterator replay_position(List &list, const int64_t &position)
+{
+    if (position < 0 || (size_t)position > list.size())
+        return list.end();
+
+    typename List::iterator it = list.before_begin();
+    for (int64_t i = 0; i < position; i++)
+        ++it;
+
+    return it;
+}
+
+/**
+ * @brief Re-executes a trace on a list and measures every call.
+ *
+ * Both `singly_linked_list` and `doubly_linked_list` can be replayed against,
+ * so the same recorded workload can compare node layouts and allocators. The
+ * list should start as the recorded one did: empty, since attaching a recorder
+ * records the list's contents as an `extend`. Iterators for `insert_after` and
+ * `erase_after` are found before their calls are timed.
+ *
+ * @tparam List The list type, which needs the batch and iterator methods of the two lists.
+ * @param path The trace file.
+ * @param list The list to run the calls on.
+ * @return The calls, failures, total time and latency percentiles of each operation.
+ * @throws TYPE_ERROR If the trace was recorded with a different value type.
+ * @throws VALUE_ERROR If the file is not a valid trace.
+ */
+template <typename List>
+trace_report replay_trace(const std::string &path, List &list)
+{
+    typedef typename List::value_type A;
+
+    static_assert(std::is_trivially_copyable<A>::value, "Traces hold trivially copyable values only");
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    list_trace_reader reader(path);
+    if (reader.kind() != list_trace::kind<A>() || reader.value_size() != sizeof(A))
+        throw TYPE_ERROR("Trace was recorded with a different value type");
+
+    trace_report report = trace_report();
+    std::vector<double> latencies[TRACE_OPS];
+    volatile size_t sink = 0;
+
+    trace_op op;
+    while (reader.next(op))
+    {
+        switch (op)
+        {
+            case trace_op::append:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { list.append(value); }, report, latencies);
+                break;
+            }
+            case trace_op::prepend:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { list.prepend(value); }, report, latencies);
+                break;
+            }
+            case trace_op::insert:
+            {
+                int64_t index = reader.get<int64_t>();
+                A value = reader.get<A>();
+                replay_call(op, [&]() { list.insert(index, value); }, report, latencies);
+                break;
+            }
+            case trace_op::insert_in_order:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { list.insert_in_order(value); }, report, latencies);
+                break;
+            }
+            case trace_op::extend:
+            {
+                std::vector<A> values((size_t)reader.get<uint64_t>());
+                for (A &value: values)
+                    value = reader.get<A>();
+                replay_call(op, [&]() { list.extend(values); }, report, latencies);
+                break;
+            }
+            case trace_op::remove:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { list.remove(value); }, report, latencies);
+                break;
+            }
+            case trace_op::remove_all:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { sink = sink + list.remove_all(value); }, report, latencies);
+                break;
+            }
+            case trace_op::erase:
+            {
+                int64_t first = reader.get<int64_t>();
+                int64_t last = reader.get<int64_t>();
+                replay_call(op, [&]() { sink = sink + list.erase(first, last); }, report, latencies);
+                break;
+            }
+            case trace_op::pop:
+            {
+                int64_t index = reader.get<int64_t>();
+                replay_call(op, [&]() { list.pop(index); }, report, latencies);
+                break;
+            }
+            case trace_op::pop_back:
+                replay_call(op, [&]() { list.pop(); }, report, latencies);
+                break;
+            case trace_op::try_pop:
+            {
+                int64_t index = reader.get<int64_t>();
+                A value;
+                replay_call(op, [&]() { sink = sink + list.try_pop(index, value); }, report, latencies);
+                break;
+            }
+            case trace_op::try_pop_back:
+            {
+                A value;
+                replay_call(op, [&]() { sink = sink + list.try_pop(value); }, report, latencies);
+                break;
+            }
+            case trace_op::try_remove:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { sink = sink + list.try_remove(value); }, report, latencies);
+                break;
+            }
+            case trace_op::contains:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { sink = sink + list.contains(value); }, report, latencies);
+                break;
+            }
+            case trace_op::index:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { sink = sink + (size_t)list.index(value); }, report, latencies);
+                break;
+            }
+            case trace_op::count:
+            {
+                A value = reader.get<A>();
+                replay_call(op, [&]() { sink = sink + list.count(value); }, report, latencies);
+                break;
+            }
+            case trace_op::try_index:
+            {
+                A value = reader.get<A>();
+                size_t index;
+                replay_call(op, [&]() { sink = sink + list.try_index(value, index); }, report, latencies);
+                break;
+            }
+            case trace_op::subscript:
+            {
+                int64_t index = reader.get<int64_t>();
+                replay_call(op, [&]() { sink = sink + (size_t)&list[index]; }, report, latencies);
+                break;
+            }
+            case trace_op::try_at:
+            {
+                int64_t index = reader.get<int64_t>();
+                replay_call(op, [&]() { sink = sink + (size_t)list.try_at(index); }, report, latencies);
+                break;
+            }
+            case trace_op::reverse:
+                replay_call(op, [&]() { list.reverse(); }, report, latencies);
+                break;
+            case trace_op::sort:
+                replay_call(op, [&]() { list.sort(); }, report, latencies);
+                break;
+            case trace_op::clear:
+                replay_call(op, [&]() { list.clear(); }, report, latencies);
+                break;
+            case trace_op::pop_front_n:
+            {
+                size_t count = (size_t)reader.get<uint64_t>();
+                replay_call(op, [&]() { sink = sink + list.pop_front_n(count).size(); }, report, latencies);
+                break;
+            }
+            case trace_op::pop_back_n:
+            {
+                size_t count = (size_t)reader.get<uint64_t>();
+                replay_call(op, [&]() { sink = sink + list.pop_back_n(count).size(); }, report, latencies);
+                break;
+            }
+            case trace_op::pop_range:
+            {
+                int64_t index = reader.get<int64_t>();
+                size_t count = (size_t)reader.get<uint64_t>();
+                replay_call(op, [&]() { sink = sink + list.pop_range(index, count).size(); }, report, latencies);
+                break;
+            }
+            case trace_op::truncate:
+            {
+                size_t new_size = (size_t)reader.get<uint64_t>();
+                replay_call(op, [&]() { sink = sink + list.truncate(new_size).size(); }, report, latencies);
+                break;
+            }
+            case trace_op::insert_after:
+            {
+                typename List::iterator pos = replay_position(list, reader.get<int64_t>());
+                A value = reader.get<A>();
+                replay_call(op, [&]() { list.insert_after(pos, value); }, report, latencies);
+                break;
+            }
+            case trace_op::erase_after:
+            {
+                int64_t begin = reader.get<int64_t>();
+                int64_t end = reader.get<int64_t>();
+                typename List::iterator first = replay_position(list, begin);
+                if (end == begin + 1)
+                {
+                    replay_call(op, [&]() { list.erase_after(first); }, report, latencies);
+                    break;
+                }
+
+                typename List::iterator last = replay_position(list, end + 1);
+                replay_call(op, [&]() { list.erase_after(first, last); }, report, latencies);
+                break;
+            }
+        }
+    }
+
+    for (int i = 0; i < TRACE_OPS; i++)
+    {
+        std::vector<double> &samples = latencies[i];
+        if (samples.empty())
+            continue;
+
+        std::sort(samples.begin(), samples.end());
+        report.p50_ns[i] = samples[samples.size() * 50 / 100];
+        report.p90_ns[i] = samples[samples.size() * 90 / 100];
+        report.p99_ns[i] = samples[samples.size() * 99 / 100];
+        report.max_ns[i] = samples.back();
+    }
+
+    report.wall_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+    return report;
+}
+
+/**
+ * @brief Writes a human readable summary of a replay.
+ *
+ * Operations that were never called are omitted.
+ *
+ * @param out The output stream to write to.
+ * @param report The report to be printed.
+ * @return The output stream.
+ */
+inline std::ostream &operator<<(std::ostream &out, const trace_report &report)
+{
+    out << "calls: " << report.total_calls() << ", wall time: " << report.wall_ns / 1e6 << " ms, throughput: "
+        << (double)report.total_calls() / (report.wall_ns / 1e9) << " calls/s\n";
+
+    for (int op = 0; op < TRACE_OPS; op++)
+    {
+        if (report.calls[op] == 0)
+            continue;
+
+        out << list_trace::name((trace_op)op) << ": " << report.calls[op] << " calls";
+        if (report.failures[op] != 0)
+            out << " (" << report.failures[op] << " failed)";
+        out << ", " << report.total_ns[op] / (double)report.calls[op] << " ns/call, latency ns p50: " << report.p50_ns[op]
+            << ", p90: " << report.p90_ns[op] << ", p99: " << report.p99_ns[op] << ", max: " << report.max_ns[op] << "\n";
+    }
+
+    return out;
+}
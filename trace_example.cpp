@@ -0,0 +1,50 @@
+#include <iostream>
+
+#include "singly_linked_list.hpp"
+#include "doubly_linked_list.hpp"
+
+/**
+ * @file trace_example.cpp
+ * @brief Demonstrates recording a list's calls and replaying them.
+ *
+ * This program attaches a `list_trace` to a singly linked list, runs a small
+ * workload on it, and replays the trace on a fresh singly linked list and a
+ * doubly linked list, printing the per-operation report of each replay.
+ *
+ * @author Harikrishna Srinivasan
+ * @date [Current Date]
+ * @version 1.0
+ */
+
+int main()
+{
+    singly_linked_list<int> queue = {5, 3};
+    {
+        list_trace recorder("queue.trace");
+        queue.set_trace(&recorder); // Records the current [5, 3] as one extend
+
+        for (int i = 0; i < 1000; i++)
+        {
+            queue.append(i);
+            if (i % 3 == 0)
+                queue.pop(0);
+            if (i % 100 == 0)
+                queue.contains(i / 2);
+        }
+        queue.insert_in_order(-1);
+        queue.sort();
+
+        queue.set_trace(nullptr);
+        std::cout << "recorded " << recorder.size() << " calls" << std::endl; // recorded 1347 calls
+    } // The recorder flushes the file when it goes out of scope
+
+    singly_linked_list<int> singly;
+    trace_report report = replay_trace("queue.trace", singly);
+    std::cout << "singly: " << report << std::endl;
+    std::cout << "same result: " << (singly == queue ? "yes" : "no") << std::endl; // same result: yes
+
+    doubly_linked_list<int> doubly;
+    std::cout << "doubly: " << replay_trace("queue.trace", doubly) << std::endl;
+
+    return 0;
+}